@@ -1,51 +1,48 @@
 // backend/src/Drone.cpp
 #include "Drone.h"
 #include "Game.h"
+#include "ai/AIScheduler.h"
+#include "entities/Archetypes.h"
+#include "projectiles/ProjectileSystem.h"
+#include "replay/BinaryStream.h"
 
-Drone::Drone(const Vector2& position, DroneType droneType)
-    : Entity(EntityType::DRONE, position, 12.0f),
+Drone::Drone(TransformStore& transforms, const Vector2& position, DroneType droneType)
+    : Entity(transforms, EntityType::DRONE, position, getArchetype(droneType).radius),
       m_droneType(droneType),
-      m_fireTimer(0.0f) {
+      m_patrolTimer(0.0f),
+      m_timeSinceThink(0.0f),
+      m_hasThought(false) {
+}
+
+template<DroneType Type>
+void Drone::think(const AIContext& context) {
+    // Decisions cover all the time elapsed since the previous one
+    float elapsed = m_timeSinceThink;
+    m_timeSinceThink = 0.0f;
+    m_hasThought = true;
     
-    // Set properties based on drone type
-    switch (m_droneType) {
-        case DroneType::CHASER:
-            m_speed = 150.0f;
-            m_fireRate = 0.0f; // Doesn't shoot
-            break;
-        case DroneType::PATROLLER:
-            m_speed = 100.0f;
-            m_fireRate = 2.0f; // Shoots every 2 seconds
-            break;
-        case DroneType::SHOOTER:
-            m_speed = 50.0f;
-            m_fireRate = 1.0f; // Shoots every second
-            break;
+    // The archetype's behaviour flags are folded in at compile time
+    constexpr const DroneArchetype& archetype = getArchetype(Type);
+    if constexpr (archetype.chasesPlayer) {
+        chasePlayer(context, archetype.speed);
+    }
+    if constexpr (archetype.patrols) {
+        patrol(elapsed, archetype.speed);
     }
 }
 
-void Drone::update(float deltaTime) {
-    // Update based on drone type
-    switch (m_droneType) {
-        case DroneType::CHASER:
-            chasePlayer(deltaTime);
-            break;
-        case DroneType::PATROLLER:
-            patrol(deltaTime);
-            if (m_fireRate > 0.0f) {
-                shoot(deltaTime);
-            }
-            break;
-        case DroneType::SHOOTER:
-            // Shooter drones mostly stay in place but may move occasionally
-            if (m_fireRate > 0.0f) {
-                shoot(deltaTime);
-            }
-            break;
-    }
-    
-    // Call parent update to apply movement
-    Entity::update(deltaTime);
+// One kernel per DroneType, called by the AI scheduler
+template void Drone::think<DroneType::CHASER>(const AIContext& context);
+template void Drone::think<DroneType::PATROLLER>(const AIContext& context);
+template void Drone::think<DroneType::SHOOTER>(const AIContext& context);
+
+float Drone::getTimerDelay() const {
+    return getArchetype(m_droneType).fireRate > 0.0f ? 0.0f : -1.0f;
+}
+
+float Drone::onTimer(const AIContext& context) {
+    shoot(context);
+    return getArchetype(m_droneType).fireRate;
 }
 
 void Drone::handleCollision(Entity* other) {
@@ -55,36 +52,67 @@ void Drone::handleCollision(Entity* other) {
     }
 }
 
-void Drone::chasePlayer(float deltaTime) {
-    // This would be implemented with access to the player position
-    // For now, just a placeholder
-    m_velocity = Vector2(1.0f, 0.0f) * m_speed;
+void Drone::chasePlayer(const AIContext& context, float speed) {
+    if (!context.hasPlayer) {
+        setVelocity(Vector2(1.0f, 0.0f) * speed);
+        return;
+    }
+    
+    // Retarget towards the player's current position
+    Vector2 toPlayer = context.playerPosition - getPosition();
+    if (toPlayer.lengthSquared() > 0.0f) {
+        setVelocity(toPlayer.normalized() * speed);
+    }
 }
 
-void Drone::patrol(float deltaTime) {
+void Drone::patrol(float deltaTime, float speed) {
     // Simple patrol behavior - move back and forth
-    static float patrolTimer = 0.0f;
-    patrolTimer += deltaTime;
+    m_patrolTimer += deltaTime;
     
-    if (patrolTimer > 2.0f) {
-        m_velocity.x = -m_velocity.x;
-        patrolTimer = 0.0f;
+    Vector2 velocity = getVelocity();
+    if (m_patrolTimer > 2.0f) {
+        velocity.x = -velocity.x;
+        m_patrolTimer = 0.0f;
     }
     
-    if (m_velocity.lengthSquared() < 0.1f) {
-        m_velocity = Vector2(1.0f, 0.0f) * m_speed;
+    if (velocity.lengthSquared() < 0.1f) {
+        velocity = Vector2(1.0f, 0.0f) * speed;
     }
+    setVelocity(velocity);
 }
 
-void Drone::shoot(float deltaTime) {
-    // Decrement fire timer
-    m_fireTimer -= deltaTime;
+void Drone::shoot(const AIContext& context) {
+    if (!context.projectiles || !context.hasPlayer) {
+        return;
+    }
     
-    if (m_fireTimer <= 0.0f) {
-        // Reset timer
-        m_fireTimer = m_fireRate;
-        
-        // Shooting logic would go here
-        // Would need access to the game to add projectiles
+    // Fire straight at the player's current position
+    Vector2 position = getPosition();
+    Vector2 toPlayer = context.playerPosition - position;
+    if (toPlayer.lengthSquared() > 0.0f) {
+        context.projectiles->spawn(position, toPlayer.normalized() * getArchetype(ProjectileType::ENEMY).speed,
+                                   ProjectileType::ENEMY, m_id);
+    }
+}
+
+void Drone::saveState(BinaryWriter& writer) const {
+    Entity::saveState(writer);
+    writer.write(static_cast<uint8_t>(m_droneType));
+    writer.write(m_patrolTimer);
+    writer.write(m_timeSinceThink);
+    writer.write(m_hasThought);
+}
+
+void Drone::loadState(BinaryReader& reader) {
+    Entity::loadState(reader);
+    // The type picks this drone's group and archetype row
+    uint8_t droneType = reader.read<uint8_t>();
+    if (droneType < kDroneTypeCount) {
+        m_droneType = static_cast<DroneType>(droneType);
+    } else {
+        reader.fail();
     }
+    reader.read(m_patrolTimer);
+    reader.read(m_timeSinceThink);
+    m_hasThought = reader.readBool();
 }
\ No newline at end of file
@@ -4,27 +4,47 @@
 #include "Entity.h"
 #include <vector>
 
+struct AIContext;
+
 enum class DroneType {
     CHASER,
     PATROLLER,
     SHOOTER
 };
 
-class Drone : public Entity {
+// Speed, fire rate and behaviour come from kDroneArchetypes
+class Drone final : public Entity {
 public:
-    Drone(const Vector2& position, DroneType droneType);
-    virtual void update(float deltaTime) override;
+    Drone(TransformStore& transforms, const Vector2& position, DroneType droneType);
     virtual void handleCollision(Entity* other) override;
     
+    // Expensive decisions, run by the AI scheduler at the drone's level of
+    // detail. The scheduler walks drones grouped by type and calls the
+    // matching instantiation directly; Type must be getDroneType().
+    template<DroneType Type>
+    void think(const AIContext& context);
+    
+    // Firing runs on the game's timing wheel, once every fireRate seconds
+    virtual float getTimerDelay() const override;
+    virtual float onTimer(const AIContext& context) override;
+    
+    // Scheduler bookkeeping
+    void accumulateThinkTime(float deltaTime) { m_timeSinceThink += deltaTime; }
+    float getTimeSinceThink() const { return m_timeSinceThink; }
+    bool hasThought() const { return m_hasThought; }
+    
     DroneType getDroneType() const { return m_droneType; }
+    
+    virtual void saveState(BinaryWriter& writer) const override;
+    virtual void loadState(BinaryReader& reader) override;
 
 private:
     DroneType m_droneType;
-    float m_speed;
-    float m_fireRate;
-    float m_fireTimer;
+    float m_patrolTimer;
+    float m_timeSinceThink;
+    bool m_hasThought;
     
-    void chasePlayer(float deltaTime);
-    void patrol(float deltaTime);
-    void shoot(float deltaTime);
+    void chasePlayer(const AIContext& context, float speed);
+    void patrol(float deltaTime, float speed);
+    void shoot(const AIContext& context);
 };
\ No newline at end of file
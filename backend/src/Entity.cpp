@@ -1,22 +1,76 @@
 // backend/src/Entity.cpp
 #include "Entity.h"
+#include "replay/BinaryStream.h"
 
-int Entity::s_nextId = 0;
+thread_local int Entity::s_nextId = 0;
 
-Entity::Entity(EntityType type, const Vector2& position, float radius)
+namespace {
+// Which entity types interact at all; everything else is culled in the broadphase
+CollisionFilter defaultCollisionFilter(EntityType type) {
+    using namespace CollisionCategory;
+    switch (type) {
+        case EntityType::PLAYER:
+            return CollisionFilter(PLAYER, DRONE | PROJECTILE | POWERUP);
+        case EntityType::DRONE:
+            return CollisionFilter(DRONE, PLAYER | PROJECTILE);
+        case EntityType::PROJECTILE:
+            return CollisionFilter(PROJECTILE, PLAYER | DRONE);
+        case EntityType::POWERUP:
+            return CollisionFilter(POWERUP, PLAYER);
+    }
+    return CollisionFilter();
+}
+}
+
+Entity::Entity(TransformStore& transforms, EntityType type, const Vector2& position, float radius)
     : m_id(s_nextId++),
       m_type(type),
-      m_position(position),
-      m_velocity(0.0f, 0.0f),
+      m_transforms(transforms),
+      m_transform(transforms.allocate(position)),
       m_radius(radius),
-      m_active(true) {
+      m_active(true),
+      m_collisionFilter(defaultCollisionFilter(type)),
+      m_broadphaseHandle(-1),
+      m_timerHandle(-1) {
+}
+
+Entity::~Entity() {
+    m_transforms.release(m_transform);
 }
 
-void Entity::update(float deltaTime) {
-    m_position = m_position + m_velocity * deltaTime;
+void Entity::update(float /*deltaTime*/) {
+    // Movement is integrated by the transform store
 }
 
 void Entity::handleCollision(Entity* other) {
     // Default collision behavior
     // Can be overridden by subclasses
+}
+
+void Entity::saveState(BinaryWriter& writer) const {
+    Vector2 position = getPosition();
+    Vector2 velocity = getVelocity();
+    writer.write(m_id);
+    writer.write(position.x);
+    writer.write(position.y);
+    writer.write(velocity.x);
+    writer.write(velocity.y);
+    writer.write(m_radius);
+    writer.write(m_active);
+    writer.write(m_collisionFilter);
+}
+
+void Entity::loadState(BinaryReader& reader) {
+    Vector2 position;
+    Vector2 velocity;
+    reader.read(m_id);
+    reader.read(position.x);
+    reader.read(position.y);
+    reader.read(velocity.x);
+    reader.read(velocity.y);
+    setPosition(position);
+    setVelocity(velocity);
+    reader.read(m_radius);
+    m_active = reader.readBool();
+    reader.read(m_collisionFilter);
 }
\ No newline at end of file
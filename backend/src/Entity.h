@@ -5,6 +5,12 @@
 #include <vector>
 #include <memory>
 #include "Vector2.h"
+#include "collision/CollisionFilter.h"
+#include "physics/TransformStore.h"
+
+class BinaryWriter;
+class BinaryReader;
+struct AIContext;
 
 enum class EntityType {
     PLAYER,
@@ -15,30 +21,70 @@ enum class EntityType {
 
 class Entity {
 public:
-    Entity(EntityType type, const Vector2& position, float radius);
-    virtual ~Entity() = default;
+    // Position and velocity live in transforms, which must outlive the entity
+    Entity(TransformStore& transforms, EntityType type, const Vector2& position, float radius);
+    virtual ~Entity();
+    Entity(const Entity&) = delete;
+    Entity& operator=(const Entity&) = delete;
     
+    // Per-tick logic. Movement is not applied here; the game integrates
+    // every transform in one pass afterwards.
     virtual void update(float deltaTime);
     virtual void handleCollision(Entity* other);
     
     // Getters and setters
     EntityType getType() const { return m_type; }
-    Vector2 getPosition() const { return m_position; }
-    void setPosition(const Vector2& position) { m_position = position; }
-    Vector2 getVelocity() const { return m_velocity; }
-    void setVelocity(const Vector2& velocity) { m_velocity = velocity; }
+    Vector2 getPosition() const { return m_transforms.getPosition(m_transform); }
+    void setPosition(const Vector2& position) { m_transforms.setPosition(m_transform, position); }
+    Vector2 getVelocity() const { return m_transforms.getVelocity(m_transform); }
+    void setVelocity(const Vector2& velocity) { m_transforms.setVelocity(m_transform, velocity); }
+    int getTransformSlot() const { return m_transform; }
     float getRadius() const { return m_radius; }
     bool isActive() const { return m_active; }
     void setActive(bool active) { m_active = active; }
     int getId() const { return m_id; }
     
+    // Broadphase filtering; defaults depend on the entity type
+    const CollisionFilter& getCollisionFilter() const { return m_collisionFilter; }
+    void setCollisionFilter(const CollisionFilter& filter) { m_collisionFilter = filter; }
+    
+    // Handle in the game's broadphase, -1 while not inserted
+    int getBroadphaseHandle() const { return m_broadphaseHandle; }
+    void setBroadphaseHandle(int handle) { m_broadphaseHandle = handle; }
+    
+    // Deadline-driven behaviour (expiry, cooldowns) runs from the game's
+    // timing wheel instead of being counted down in update().
+    // getTimerDelay() is the delay in seconds to the first onTimer() call
+    // after the entity is added, negative for none; onTimer() returns the
+    // delay to the next call, negative to stop.
+    virtual float getTimerDelay() const { return -1.0f; }
+    virtual float onTimer(const AIContext& /*context*/) { return -1.0f; }
+    
+    // Handle in the game's timing wheel, -1 while nothing is scheduled
+    int getTimerHandle() const { return m_timerHandle; }
+    void setTimerHandle(int handle) { m_timerHandle = handle; }
+    
+    // Replay keyframes. loadState() overwrites every field, including the id,
+    // of an entity freshly constructed with the same EntityType.
+    virtual void saveState(BinaryWriter& writer) const;
+    virtual void loadState(BinaryReader& reader);
+    
+    // Ids come from a per-thread counter. Id allocation is part of the
+    // saved game state, and a Game swaps its own counter in while it runs,
+    // so games on different threads never share one.
+    static int getNextId() { return s_nextId; }
+    static void setNextId(int id) { s_nextId = id; }
+
 protected:
-    static int s_nextId;
+    static thread_local int s_nextId;
     
     int m_id;
     EntityType m_type;
-    Vector2 m_position;
-    Vector2 m_velocity;
+    TransformStore& m_transforms;
+    int m_transform;
     float m_radius;
     bool m_active;
+    CollisionFilter m_collisionFilter;
+    int m_broadphaseHandle;
+    int m_timerHandle;
 };
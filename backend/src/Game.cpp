@@ -1,32 +1,124 @@
 // backend/src/Game.cpp
 #include "Game.h"
+#include "profiling/Profiler.h"
+#include "replay/BinaryStream.h"
+#include "include/PowerUp.h"
+#include "include/Projectile.h"
+#include "entities/Archetypes.h"
 #include <algorithm>
-#include <cstdlib>
+#include <chrono>
+#include <cmath>
 #include <ctime>
 
-Game::Game()
+namespace {
+const float kProjectileDamage = 10.0f;
+
+// Decisions per frame when the AI budget must not depend on wall time
+const int kDeterministicThinkBudget = 64;
+
+// Golden-ratio step between the seeds of consecutive matches
+const uint64_t kSeedStep = 0x9E3779B97F4A7C15ULL;
+
+// Distance an entity can drift before its grid entry is rebinned
+const float kBroadphaseFatMargin = 2.0f;
+
+// Resolution of entity timers
+const float kTimerStep = 1.0f / 60.0f;
+
+// Installs a game's entity id counter on this thread for one call
+class EntityIdScope {
+public:
+    explicit EntityIdScope(int& nextId) : m_nextId(nextId), m_outer(Entity::getNextId()) {
+        Entity::setNextId(nextId);
+    }
+    
+    ~EntityIdScope() {
+        m_nextId = Entity::getNextId();
+        Entity::setNextId(m_outer);
+    }
+    
+    EntityIdScope(const EntityIdScope&) = delete;
+    EntityIdScope& operator=(const EntityIdScope&) = delete;
+
+private:
+    int& m_nextId;
+    int m_outer;
+};
+
+// Prefab names, indexed by DroneType
+const char* const kDronePrefabNames[kDroneTypeCount] = {"drone.chaser", "drone.patroller", "drone.shooter"};
+
+// Per-tick pass over one class of entity. Classes with nothing to do each
+// tick compile to an empty loop; the rest call update() non-virtually.
+template<typename T>
+void updateGroup(const std::vector<T*>& group, float deltaTime) {
+    if constexpr (EntityTraits<T>::kUpdatesEveryTick) {
+        for (T* entity : group) {
+            entity->T::update(deltaTime);
+        }
+    }
+}
+}
+
+Game::Game(size_t projectileCapacity)
     : m_state(GameState::MENU),
       m_worldWidth(800.0f),
-      m_worldHeight(600.0f) {
-    // Seed random number generator
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
+      m_worldHeight(600.0f),
+      m_seed(static_cast<uint64_t>(std::time(nullptr))),
+      m_matchSeed(0),
+      m_deterministic(false),
+      m_effectsEnabled(true),
+      m_nextEntityId(0),
+      m_projectiles(projectileCapacity),
+      m_timerAccumulator(0.0f),
+      m_ownFrameArena(64 * 1024),
+      m_frameArena(&m_ownFrameArena),
+      m_lastPairCount(0) {
+    m_grid.setFatMargin(kBroadphaseFatMargin);
+    
+    // Resolve prefab names once; spawning only uses the ids
+    for (int i = 0; i < kDroneTypeCount; ++i) {
+        m_dronePrefabs[i] = m_entityManager.registerPrefab(
+            kDronePrefabNames[i], EntityManager::makePrefab<Drone>(m_transforms, static_cast<DroneType>(i)));
+    }
 }
 
 Game::~Game() = default;
 
 void Game::initialize() {
+    EntityIdScope ids(m_nextEntityId);
+    
     // Reset game state
     m_state = GameState::PLAYING;
     m_entities.clear();
+    regroupEntities();
+    m_projectiles.clear();
+    m_grid.clear();
+    m_pairCache.clear();
+    m_timers.clear();
+    m_timerAccumulator = 0.0f;
+    m_waves.reset();
+    m_aiScheduler.setCursor(0);
+    
+    // Seed this match; the next one gets a different seed unless setSeed() is called
+    m_matchSeed = m_seed;
+    m_seed += kSeedStep;
+    m_random.setSeed(m_matchSeed);
+    m_stats = GameStats();
+    m_events.setFrame(0);
+    m_avgFrameTime.reset();
+    m_avgPairTests.reset();
+    m_avgCollisions.reset();
+    m_avgAllocations.reset();
+    m_projectiles.setBounds(Vector2(0.0f, 0.0f), Vector2(m_worldWidth, m_worldHeight));
+    m_grid.setBounds(Vector2(0.0f, 0.0f), Vector2(m_worldWidth, m_worldHeight));
     
     // Create player
-    m_player = std::make_shared<Player>(Vector2(m_worldWidth / 2, m_worldHeight / 2));
-    m_entities.push_back(m_player);
+    m_player = std::make_shared<Player>(m_transforms, Vector2(m_worldWidth / 2, m_worldHeight / 2));
+    addEntity(m_player);
     
-    // Spawn initial drones
-    for (int i = 0; i < 5; ++i) {
-        spawnDrone(static_cast<DroneType>(std::rand() % 3));
-    }
+    // The first wave starts immediately
+    runWaves(0.0f);
 }
 
 void Game::update(float deltaTime) {
@@ -34,10 +126,50 @@ void Game::update(float deltaTime) {
         return;
     }
     
-    // Update all entities
-    for (auto& entity : m_entities) {
-        entity->update(deltaTime);
+    PROFILE_ZONE("Game::update");
+    EntityIdScope ids(m_nextEntityId);
+    
+    auto frameStart = std::chrono::steady_clock::now();
+    AllocationTracker::Snapshot allocationsAtStart = AllocationTracker::snapshot();
+    m_stats.pairTests = 0;
+    m_stats.filteredPairs = 0;
+    m_stats.collisions = 0;
+    m_stats.projectileHits = 0;
+    m_stats.contactBegins = 0;
+    m_stats.contactEnds = 0;
+    m_stats.timersFired = 0;
+    m_events.setFrame(m_stats.frame);
+    
+    // Run the drone decisions that are due this frame
+    AIContext context;
+    context.hasPlayer = m_player && m_player->isActive();
+    if (context.hasPlayer) {
+        context.playerPosition = m_player->getPosition();
     }
+    context.viewMin = Vector2(0.0f, 0.0f);
+    context.viewMax = Vector2(m_worldWidth, m_worldHeight);
+    context.projectiles = &m_projectiles;
+    m_aiScheduler.update(m_drones, context, deltaTime);
+    
+    // Update the classes that need a per-tick pass, then move everything in one
+    if (m_player) {
+        m_player->Player::update(deltaTime);
+    }
+    for (const auto& drones : m_drones) {
+        updateGroup(drones, deltaTime);
+    }
+    updateGroup(m_projectileEntities, deltaTime);
+    if (m_effectsEnabled) {
+        updateGroup(m_powerUps, deltaTime);
+    }
+    m_transforms.integrate(deltaTime);
+    
+    // Fire the entity timers that came due
+    advanceTimers(deltaTime, context);
+    
+    // Spawn and advance projectiles
+    firePlayerProjectile();
+    m_projectiles.update(deltaTime);
     
     // Check for collisions
     checkCollisions();
@@ -48,16 +180,70 @@ void Game::update(float deltaTime) {
     // Check game over condition
     if (!m_player->isActive()) {
         m_state = GameState::GAME_OVER;
+        m_events.emit(GameEventType::PLAYER_DIED, m_player->getId(), -1,
+                      m_player->getPosition().x, m_player->getPosition().y);
+    }
+    
+    // Start waves and spawn this frame's share of their drones
+    runWaves(deltaTime);
+    
+    float frameTimeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+    finishFrameStats(deltaTime, frameTimeMs, allocationsAtStart);
+    
+    // Without an engine-owned arena, frame memory ends with this update
+    if (m_frameArena == &m_ownFrameArena) {
+        m_ownFrameArena.reset();
+    }
+}
+
+void Game::setFrameArena(FrameArena* arena) {
+    m_frameArena = arena ? arena : &m_ownFrameArena;
+}
+
+void Game::finishFrameStats(float deltaTime, float frameTimeMs, const AllocationTracker::Snapshot& allocationsAtStart) {
+    m_stats.frame++;
+    m_stats.simulationTime += deltaTime;
+    m_stats.frameTimeMs = frameTimeMs;
+    
+    // Entity counts by type
+    for (uint32_t& count : m_stats.entityCounts) {
+        count = 0;
     }
+    for (const auto& entity : m_entities) {
+        m_stats.entityCounts[static_cast<int>(entity->getType())]++;
+    }
+    m_stats.entityCounts[static_cast<int>(EntityType::PROJECTILE)] += static_cast<uint32_t>(m_projectiles.getCount());
+    m_stats.timersPending = static_cast<uint32_t>(m_timers.getPendingCount());
+    m_stats.wave = static_cast<uint32_t>(m_waves.getWave());
+    m_stats.pendingSpawns = static_cast<uint32_t>(m_waves.getPendingCount());
     
-    // Spawn new drones periodically
-    static float spawnTimer = 0.0f;
-    spawnTimer += deltaTime;
+    AllocationTracker::Snapshot allocations = AllocationTracker::since(allocationsAtStart, AllocationTracker::snapshot());
+    m_stats.allocations = static_cast<uint32_t>(allocations.allocations);
+    m_stats.allocatedBytes = static_cast<uint32_t>(allocations.bytes);
+    m_stats.arenaUsedBytes = static_cast<uint32_t>(m_frameArena->getUsed());
+    m_stats.arenaHighWaterBytes = static_cast<uint32_t>(std::max(m_frameArena->getHighWaterMark(), m_frameArena->getUsed()));
     
-    if (spawnTimer > 2.0f) {
-        spawnTimer = 0.0f;
-        spawnDrone(static_cast<DroneType>(std::rand() % 3));
+    // AI scheduler
+    const AIStats& ai = m_aiScheduler.getStats();
+    m_stats.aiThinks = static_cast<uint32_t>(ai.thinksRun);
+    m_stats.aiDeferred = static_cast<uint32_t>(ai.thinksDeferred);
+    m_stats.aiBudgetOverruns = ai.budgetOverruns;
+    m_stats.aiCostMs = ai.frameCostMs;
+    for (int type = 0; type < kDroneTypeCount; ++type) {
+        m_stats.aiCostUsPerThink[type] = ai.thinksByType[type] > 0
+            ? static_cast<float>(ai.costMsByType[type] * 1000.0 / ai.thinksByType[type])
+            : 0.0f;
     }
+    
+    // Rolling averages
+    m_avgFrameTime.add(m_stats.frameTimeMs);
+    m_avgPairTests.add(static_cast<float>(m_stats.pairTests));
+    m_avgCollisions.add(static_cast<float>(m_stats.collisions));
+    m_avgAllocations.add(static_cast<float>(m_stats.allocations));
+    m_stats.avgFrameTimeMs = m_avgFrameTime.get();
+    m_stats.avgPairTests = m_avgPairTests.get();
+    m_stats.avgCollisions = m_avgCollisions.get();
+    m_stats.avgAllocations = m_avgAllocations.get();
 }
 
 void Game::handleInput(PlayerInput input, bool pressed) {
@@ -70,57 +256,396 @@ void Game::handleInput(PlayerInput input, bool pressed) {
     }
 }
 
-void Game::spawnDrone(DroneType type) {
-    // Random position at the edge of the screen
-    Vector2 position;
-    int side = std::rand() % 4;
+void Game::setWorldSize(float width, float height) {
+    m_worldWidth = width;
+    m_worldHeight = height;
+    m_projectiles.setBounds(Vector2(0.0f, 0.0f), Vector2(width, height));
+    m_grid.setBounds(Vector2(0.0f, 0.0f), Vector2(width, height));
+}
+
+void Game::setDeterministic(bool deterministic) {
+    m_deterministic = deterministic;
+    m_aiScheduler.setThinkBudget(deterministic ? kDeterministicThinkBudget : 0);
+}
+
+void Game::saveState(BinaryWriter& writer) const {
+    writer.write(static_cast<int32_t>(m_state));
+    writer.write(m_worldWidth);
+    writer.write(m_worldHeight);
+    writer.write(m_seed);
+    writer.write(m_matchSeed);
+    writer.write(m_random.getState());
+    writer.write(static_cast<int32_t>(m_nextEntityId));
+    writer.write(static_cast<uint64_t>(m_aiScheduler.getCursor()));
+    writer.write(m_stats.frame);
+    writer.write(m_stats.simulationTime);
+    writer.write(m_timers.getNow());
+    writer.write(m_timerAccumulator);
+    m_waves.saveState(writer);
+    
+    // Entities in update order, each tagged with its type and followed by
+    // its timer deadline (0 for none)
+    writer.write(static_cast<uint32_t>(m_entities.size()));
+    for (const auto& entity : m_entities) {
+        writer.write(static_cast<uint8_t>(entity->getType()));
+        entity->saveState(writer);
+        int timer = entity->getTimerHandle();
+        writer.write(timer >= 0 ? m_timers.getDeadline(timer) : uint64_t(0));
+    }
+    
+    m_projectiles.saveState(writer);
     
-    switch (side) {
-        case 0: // Top
-            position = Vector2(std::rand() % static_cast<int>(m_worldWidth), 0);
+    // Contacts in progress, so restored pairs do not begin a second time
+    std::vector<std::pair<int, int>> touching;
+    m_pairCache.getTouchingIds(touching);
+    writer.write(static_cast<uint32_t>(touching.size()));
+    for (const auto& ids : touching) {
+        writer.write(static_cast<int32_t>(ids.first));
+        writer.write(static_cast<int32_t>(ids.second));
+    }
+}
+
+bool Game::loadState(BinaryReader& reader) {
+    EntityIdScope ids(m_nextEntityId);
+    m_entities.clear();
+    m_player.reset();
+    m_projectiles.clear();
+    m_grid.clear();
+    m_pairCache.clear();
+    
+    int32_t state = reader.read<int32_t>();
+    float worldWidth = reader.read<float>();
+    float worldHeight = reader.read<float>();
+    reader.read(m_seed);
+    reader.read(m_matchSeed);
+    m_random.setState(reader.read<uint64_t>());
+    int32_t nextId = reader.read<int32_t>();
+    m_aiScheduler.setCursor(static_cast<size_t>(reader.read<uint64_t>()));
+    m_stats = GameStats();
+    reader.read(m_stats.frame);
+    reader.read(m_stats.simulationTime);
+    m_timers.clear(reader.read<uint64_t>());
+    reader.read(m_timerAccumulator);
+    bool wavesValid = m_waves.loadState(reader);
+    setWorldSize(worldWidth, worldHeight);
+    
+    uint32_t entityCount = reader.read<uint32_t>();
+    for (uint32_t i = 0; i < entityCount && !reader.failed(); ++i) {
+        std::shared_ptr<Entity> entity;
+        switch (static_cast<EntityType>(reader.read<uint8_t>())) {
+            case EntityType::PLAYER:
+                m_player = std::make_shared<Player>(m_transforms, Vector2());
+                entity = m_player;
+                break;
+            case EntityType::DRONE:
+                entity = std::make_shared<Drone>(m_transforms, Vector2(), DroneType::CHASER);
+                break;
+            case EntityType::PROJECTILE:
+                entity = std::make_shared<Projectile>(m_transforms, Vector2(), Vector2(), 0.0f, ProjectileType::PLAYER);
+                break;
+            case EntityType::POWERUP:
+                entity = std::make_shared<PowerUp>(m_transforms, Vector2(), PowerUpType::HEALTH);
+                break;
+            default:
+                reader.fail();
+                continue;
+        }
+        entity->loadState(reader);
+        uint64_t deadline = reader.read<uint64_t>();
+        if (deadline > 0) {
+            entity->setTimerHandle(m_timers.schedule(deadline, entity.get()));
+        }
+        m_entities.push_back(entity);
+    }
+    regroupEntities();
+    
+    // Ids handed out while rebuilding are not part of the saved match
+    Entity::setNextId(nextId);
+    
+    bool valid = m_projectiles.loadState(reader) && wavesValid;
+    
+    uint32_t touchingCount = reader.read<uint32_t>();
+    std::vector<std::pair<int, int>> touching;
+    for (uint32_t i = 0; i < touchingCount && !reader.failed(); ++i) {
+        int32_t idA = reader.read<int32_t>();
+        int32_t idB = reader.read<int32_t>();
+        touching.emplace_back(idA, idB);
+    }
+    m_pairCache.restoreTouching(touching);
+    
+    valid = valid && !reader.failed() &&
+                 state >= static_cast<int32_t>(GameState::MENU) &&
+                 state <= static_cast<int32_t>(GameState::GAME_OVER) &&
+                 (m_player || state != static_cast<int32_t>(GameState::PLAYING));
+    if (!valid) {
+        m_timers.clear();
+        m_entities.clear();
+        regroupEntities();
+        m_player.reset();
+        m_projectiles.clear();
+        m_state = GameState::MENU;
+        return false;
+    }
+    
+    m_state = static_cast<GameState>(state);
+    return true;
+}
+
+void Game::firePlayerProjectile() {
+    if (!m_player || !m_player->isActive() || !m_player->consumeShot()) {
+        return;
+    }
+    
+    Vector2 direction = m_player->getAimDirection();
+    m_projectiles.spawn(m_player->getPosition(), direction * getArchetype(ProjectileType::PLAYER).speed,
+                        ProjectileType::PLAYER, m_player->getId());
+    m_events.emit(GameEventType::PROJECTILE_FIRED, m_player->getId(), -1,
+                  m_player->getPosition().x, m_player->getPosition().y);
+}
+
+void Game::addEntity(const std::shared_ptr<Entity>& entity) {
+    m_entities.push_back(entity);
+    trackEntity(*entity);
+}
+
+void Game::trackEntity(Entity& entity) {
+    addToGroup(entity);
+    
+    float delay = entity.getTimerDelay();
+    if (delay >= 0.0f) {
+        scheduleTimer(entity, delay);
+    }
+}
+
+void Game::addToGroup(Entity& entity) {
+    // Every class below is final, so the type tag identifies it exactly
+    switch (entity.getType()) {
+        case EntityType::DRONE: {
+            Drone& drone = static_cast<Drone&>(entity);
+            m_drones[static_cast<int>(drone.getDroneType())].push_back(&drone);
             break;
-        case 1: // Right
-            position = Vector2(m_worldWidth, std::rand() % static_cast<int>(m_worldHeight));
+        }
+        case EntityType::PROJECTILE:
+            m_projectileEntities.push_back(static_cast<Projectile*>(&entity));
             break;
-        case 2: // Bottom
-            position = Vector2(std::rand() % static_cast<int>(m_worldWidth), m_worldHeight);
+        case EntityType::POWERUP:
+            m_powerUps.push_back(static_cast<PowerUp*>(&entity));
             break;
-        case 3: // Left
-            position = Vector2(0, std::rand() % static_cast<int>(m_worldHeight));
+        default:
             break;
     }
+}
+
+void Game::regroupEntities() {
+    for (auto& drones : m_drones) {
+        drones.clear();
+    }
+    m_projectileEntities.clear();
+    m_powerUps.clear();
+    for (const auto& entity : m_entities) {
+        addToGroup(*entity);
+    }
+}
+
+size_t Game::getDroneCount() const {
+    size_t count = 0;
+    for (const auto& drones : m_drones) {
+        count += drones.size();
+    }
+    return count;
+}
+
+void Game::runWaves(float deltaTime) {
+    SpawnRequest requests[kDroneTypeCount];
+    int requestCount = m_waves.update(deltaTime, static_cast<int>(getDroneCount()), requests);
+    for (int i = 0; i < requestCount; ++i) {
+        spawnDrones(requests[i].type, requests[i].count);
+    }
     
-    // Create and add drone
-    auto drone = std::make_shared<Drone>(position, type);
-    m_entities.push_back(drone);
+    // Reserve for the next wave ahead of time so its frames never reallocate
+    int upcoming = m_waves.takePrewarm();
+    if (upcoming > 0) {
+        m_entities.reserve(m_entities.size() + upcoming);
+        for (auto& drones : m_drones) {
+            drones.reserve(drones.size() + upcoming);
+        }
+        m_transforms.reserve(upcoming);
+        m_spawnPositions.reserve(m_waves.getSpawnBudget());
+    }
+}
+
+void Game::spawnDrones(DroneType type, int count) {
+    // Random positions at the edge of the screen
+    m_spawnPositions.clear();
+    for (int i = 0; i < count; ++i) {
+        Vector2 position;
+        int side = m_random.nextInt(4);
+        
+        switch (side) {
+            case 0: // Top
+                position = Vector2(m_random.nextInt(static_cast<int>(m_worldWidth)), 0);
+                break;
+            case 1: // Right
+                position = Vector2(m_worldWidth, m_random.nextInt(static_cast<int>(m_worldHeight)));
+                break;
+            case 2: // Bottom
+                position = Vector2(m_random.nextInt(static_cast<int>(m_worldWidth)), m_worldHeight);
+                break;
+            case 3: // Left
+                position = Vector2(0, m_random.nextInt(static_cast<int>(m_worldHeight)));
+                break;
+        }
+        m_spawnPositions.push_back(position);
+    }
+    
+    // Create the whole batch, then register each drone with the game
+    size_t first = m_entityManager.spawnBatch(m_dronePrefabs[static_cast<int>(type)], m_spawnPositions.size(),
+                                              m_spawnPositions.data(), m_entities);
+    for (size_t i = first; i < m_entities.size(); ++i) {
+        Entity& drone = *m_entities[i];
+        trackEntity(drone);
+        m_events.emit(GameEventType::DRONE_SPAWNED, drone.getId(), -1, drone.getPosition().x, drone.getPosition().y,
+                      static_cast<float>(type));
+    }
 }
 
 void Game::checkCollisions() {
-    // Simple collision detection between entities
-    for (size_t i = 0; i < m_entities.size(); ++i) {
-        for (size_t j = i + 1; j < m_entities.size(); ++j) {
-            auto& a = m_entities[i];
-            auto& b = m_entities[j];
-            
-            // Skip inactive entities
-            if (!a->isActive() || !b->isActive()) {
-                continue;
-            }
-            
-            // Check distance between entities
-            float distance = Vector2::distance(a->getPosition(), b->getPosition());
-            float minDistance = a->getRadius() + b->getRadius();
-            
-            if (distance < minDistance) {
-                // Handle collision
-                a->handleCollision(b.get());
-                b->handleCollision(a.get());
+    PROFILE_ZONE("Game::checkCollisions");
+    
+    updateBroadphase();
+    
+    // Only entities that moved are re-queried; touching pairs between
+    // entities that stood still are reported as staying without a test
+    m_stats.broadphaseMoved = static_cast<uint32_t>(m_grid.getMovedHandles().size());
+    m_pairCache.update(m_grid);
+    m_stats.cachedPairs = static_cast<uint32_t>(m_pairCache.getPairCount());
+    
+    // Gather the touching entity pairs into frame memory
+    ArenaVector<Contact> contacts{ArenaAllocator<Contact>(*m_frameArena)};
+    contacts.reserve(m_lastPairCount + 16);
+    for (const ContactEvent& event : m_pairCache.getEvents()) {
+        if (event.phase == ContactPhase::END) {
+            m_stats.contactEnds++;
+            continue;
+        }
+        if (event.phase == ContactPhase::BEGIN) {
+            m_stats.contactBegins++;
+        }
+        contacts.emplace_back(m_entities[event.userIndexA].get(), m_entities[event.userIndexB].get(), event.phase);
+    }
+    m_lastPairCount = contacts.size();
+    BroadphaseCounts counts = m_pairCache.getCounts();
+    
+    // Resolve them in per-type-pair batches
+    m_stats.collisions += static_cast<uint32_t>(m_collisionDispatcher.dispatch(contacts, *m_frameArena, m_events));
+    
+    // Projectiles against the same broadphase
+    m_projectiles.collide(m_grid, m_entities);
+    counts += m_projectiles.getBroadphaseCounts();
+    m_stats.pairTests += static_cast<uint32_t>(counts.distanceTests);
+    m_stats.filteredPairs += static_cast<uint32_t>(counts.filteredPairs);
+    m_stats.projectileHits += static_cast<uint32_t>(m_projectiles.getHits().size());
+    for (const ProjectileHit& hit : m_projectiles.getHits()) {
+        Vector2 position = hit.target->getPosition();
+        if (hit.target->getType() == EntityType::PLAYER) {
+            static_cast<Player*>(hit.target)->takeDamage(kProjectileDamage);
+            m_events.emit(GameEventType::PLAYER_DAMAGED, hit.target->getId(), hit.sourceId,
+                          position.x, position.y, kProjectileDamage);
+        } else {
+            hit.target->setActive(false);
+            if (hit.target->getType() == EntityType::DRONE) {
+                m_events.emit(GameEventType::DRONE_DESTROYED, hit.target->getId(), hit.sourceId,
+                              position.x, position.y);
             }
         }
     }
 }
 
+void Game::updateBroadphase() {
+    // Entities keep their grid entries between frames; only those that
+    // changed cell are relinked
+    for (size_t i = 0; i < m_entities.size(); ++i) {
+        Entity& entity = *m_entities[i];
+        if (!entity.isActive()) {
+            releaseBroadphase(entity);
+            continue;
+        }
+        
+        if (entity.getBroadphaseHandle() < 0) {
+            entity.setBroadphaseHandle(m_grid.add(static_cast<int>(i), entity.getPosition(), entity.getRadius(),
+                                                  entity.getCollisionFilter(), entity.getId()));
+        } else {
+            m_grid.update(entity.getBroadphaseHandle(), static_cast<int>(i), entity.getPosition(),
+                          entity.getRadius(), entity.getCollisionFilter(), entity.getId());
+        }
+    }
+}
+
+void Game::releaseBroadphase(Entity& entity) {
+    if (entity.getBroadphaseHandle() >= 0) {
+        m_grid.remove(entity.getBroadphaseHandle());
+        entity.setBroadphaseHandle(-1);
+    }
+}
+
+void Game::advanceTimers(float deltaTime, const AIContext& context) {
+    PROFILE_ZONE("Game::advanceTimers");
+    
+    // Whole ticks only; the remainder carries over to the next frame
+    m_timerAccumulator += deltaTime;
+    uint64_t ticks = static_cast<uint64_t>(m_timerAccumulator / kTimerStep + 0.001f);
+    m_timerAccumulator -= static_cast<float>(ticks) * kTimerStep;
+    if (ticks == 0) {
+        return;
+    }
+    
+    m_expiredTimers.clear();
+    m_timers.advance(ticks, m_expiredTimers);
+    
+    // Slot order depends on scheduling history, which a restored replay
+    // does not share; fire in id order so both runs agree
+    std::sort(m_expiredTimers.begin(), m_expiredTimers.end(),
+              [](const Entity* a, const Entity* b) { return a->getId() < b->getId(); });
+    
+    for (Entity* entity : m_expiredTimers) {
+        entity->setTimerHandle(-1);
+        if (!entity->isActive()) {
+            continue;
+        }
+        
+        float delay = entity->onTimer(context);
+        m_stats.timersFired++;
+        if (delay >= 0.0f && entity->isActive()) {
+            scheduleTimer(*entity, delay);
+        }
+    }
+}
+
+void Game::scheduleTimer(Entity& entity, float delay) {
+    // Round up so a timer never fires early; a zero delay means next tick
+    uint64_t ticks = static_cast<uint64_t>(std::max(1.0f, std::ceil(delay / kTimerStep - 0.001f)));
+    entity.setTimerHandle(m_timers.schedule(m_timers.getNow() + ticks, &entity));
+}
+
+void Game::releaseTimer(Entity& entity) {
+    if (entity.getTimerHandle() >= 0) {
+        m_timers.cancel(entity.getTimerHandle());
+        entity.setTimerHandle(-1);
+    }
+}
+
 void Game::removeInactiveEntities() {
+    PROFILE_ZONE("Game::removeInactiveEntities");
+    
+    // Entities deactivated during this frame still hold grid entries and
+    // may have timers pending; cancel them before the entity goes away
+    for (const auto& entity : m_entities) {
+        if (!entity->isActive()) {
+            releaseBroadphase(*entity);
+            releaseTimer(*entity);
+        }
+    }
+    
     // Keep the player even if inactive
     auto playerIt = std::find(m_entities.begin(), m_entities.end(), m_player);
     if (playerIt != m_entities.end()) {
@@ -140,4 +665,5 @@ void Game::removeInactiveEntities() {
             m_entities.end()
         );
     }
+    regroupEntities();
 }
\ No newline at end of file
@@ -6,6 +6,25 @@
 #include "Entity.h"
 #include "Player.h"
 #include "Drone.h"
+#include "include/Projectile.h"
+#include "include/PowerUp.h"
+#include "ai/AIScheduler.h"
+#include "ai/WaveDirector.h"
+#include "entities/EntityManager.h"
+#include "collision/HierarchicalGrid.h"
+#include "collision/PairCache.h"
+#include "collision/CollisionDispatcher.h"
+#include "projectiles/ProjectileSystem.h"
+#include "engine/GameEvents.h"
+#include "engine/GameStats.h"
+#include "engine/Random.h"
+#include "engine/TimingWheel.h"
+#include "memory/AllocationTracker.h"
+#include "memory/FrameArena.h"
+#include "physics/TransformStore.h"
+
+class BinaryWriter;
+class BinaryReader;
 
 enum class GameState {
     MENU,
@@ -15,27 +34,136 @@ enum class GameState {
 
 class Game {
 public:
-    Game();
+    // Many small games (batched training) can shrink the projectile pool
+    explicit Game(size_t projectileCapacity = kDefaultProjectileCapacity);
     ~Game();
     
     void initialize();
     void update(float deltaTime);
     void handleInput(PlayerInput input, bool pressed);
+    void setWorldSize(float width, float height);
+    float getWorldWidth() const { return m_worldWidth; }
+    float getWorldHeight() const { return m_worldHeight; }
+    
+    // Seed for the next initialize(); matches after that derive their own
+    void setSeed(uint64_t seed) { m_seed = seed; }
+    uint64_t getSeed() const { return m_matchSeed; }
+    
+    // Make update() depend only on the saved state, the input and the time
+    // step, with no wall-clock budgets. Required for recording replays.
+    void setDeterministic(bool deterministic);
+    bool isDeterministic() const { return m_deterministic; }
+    
+    // Cosmetic per-tick work (power-up pulsing); the frame governor turns it off under load
+    void setEffectsEnabled(bool enabled) { m_effectsEnabled = enabled; }
+    bool areEffectsEnabled() const { return m_effectsEnabled; }
+    
+    // Full simulation state for replay keyframes. Statistics and frame
+    // memory are not included. loadState() returns false on a malformed
+    // or truncated block and leaves the game in the MENU state.
+    void saveState(BinaryWriter& writer) const;
+    bool loadState(BinaryReader& reader);
+    
+    // Per-tick scratch memory. When set, the owner resets it after each tick;
+    // otherwise the game uses and resets its own arena.
+    void setFrameArena(FrameArena* arena);
     
     // Getters
     GameState getState() const { return m_state; }
     const std::vector<std::shared_ptr<Entity>>& getEntities() const { return m_entities; }
     const Player* getPlayer() const { return m_player.get(); }
+    Player* getPlayer() { return m_player.get(); }
+    const ProjectileSystem& getProjectiles() const { return m_projectiles; }
+    
+    // Entity positions and velocities; physics bodies share the same slots
+    TransformStore& getTransforms() { return m_transforms; }
+    const TransformStore& getTransforms() const { return m_transforms; }
+    
+    // AI scheduling
+    AIScheduler& getAIScheduler() { return m_aiScheduler; }
+    WaveDirector& getWaveDirector() { return m_waves; }
+    const AIStats& getAIStats() const { return m_aiScheduler.getStats(); }
     
+    // Runtime statistics for the last completed frame
+    const GameStats& getStats() const { return m_stats; }
+    
+    // Gameplay events written during update(); readers drain them with
+    // their own cursor after each frame
+    const GameEventBus& getEvents() const { return m_events; }
+
 private:
+    // Declared first so it outlives the entities that hold slots in it
+    TransformStore m_transforms;
+    
     GameState m_state;
     std::vector<std::shared_ptr<Entity>> m_entities;
     std::shared_ptr<Player> m_player;
     
+    // m_entities again, split by class so per-tick loops call update()
+    // without virtual dispatch; the player is m_player. Drones are further
+    // split by DroneType, so the AI scheduler runs each type's kernel directly.
+    DroneGroups m_drones;
+    std::vector<Projectile*> m_projectileEntities;
+    std::vector<PowerUp*> m_powerUps;
+    
     float m_worldWidth;
     float m_worldHeight;
     
-    void spawnDrone(DroneType type);
+    // Gameplay randomness and drone spawning
+    uint64_t m_seed;
+    uint64_t m_matchSeed;
+    Random m_random;
+    bool m_deterministic;
+    bool m_effectsEnabled;
+    
+    // This game's entity ids; installed on the running thread by each call that creates entities
+    int m_nextEntityId;
+    
+    // Prefab registry; spawned entities go into m_entities
+    EntityManager m_entityManager;
+    PrefabId m_dronePrefabs[kDroneTypeCount];
+    std::vector<Vector2> m_spawnPositions;
+    
+    WaveDirector m_waves;
+    AIScheduler m_aiScheduler;
+    ProjectileSystem m_projectiles;
+    HierarchicalGrid m_grid;
+    PairCache m_pairCache;
+    CollisionDispatcher m_collisionDispatcher;
+    GameEventBus m_events;
+    
+    // Entity deadlines in fixed ticks; only the entities whose deadline
+    // lands in a tick are touched by it
+    TimingWheel<Entity*> m_timers;
+    float m_timerAccumulator;
+    std::vector<Entity*> m_expiredTimers;
+    
+    // Per-tick scratch memory
+    FrameArena m_ownFrameArena;
+    FrameArena* m_frameArena;
+    size_t m_lastPairCount;
+    
+    // Statistics
+    GameStats m_stats;
+    RollingAverage<kStatsWindow> m_avgFrameTime;
+    RollingAverage<kStatsWindow> m_avgPairTests;
+    RollingAverage<kStatsWindow> m_avgCollisions;
+    RollingAverage<kStatsWindow> m_avgAllocations;
+    
+    void addEntity(const std::shared_ptr<Entity>& entity);
+    void trackEntity(Entity& entity);
+    void addToGroup(Entity& entity);
+    void regroupEntities();
+    size_t getDroneCount() const;
+    void runWaves(float deltaTime);
+    void spawnDrones(DroneType type, int count);
+    void firePlayerProjectile();
     void checkCollisions();
+    void updateBroadphase();
+    void releaseBroadphase(Entity& entity);
+    void advanceTimers(float deltaTime, const AIContext& context);
+    void scheduleTimer(Entity& entity, float delay);
+    void releaseTimer(Entity& entity);
     void removeInactiveEntities();
+    void finishFrameStats(float deltaTime, float frameTimeMs, const AllocationTracker::Snapshot& allocationsAtStart);
 };
\ No newline at end of file
@@ -1,62 +1,79 @@
 // backend/src/Player.cpp
 #include "Player.h"
+#include "replay/BinaryStream.h"
 
-Player::Player(const Vector2& position)
-    : Entity(EntityType::PLAYER, position, 15.0f),
+Player::Player(TransformStore& transforms, const Vector2& position)
+    : Entity(transforms, EntityType::PLAYER, position, 15.0f),
       m_speed(200.0f),
       m_health(100.0f),
-      m_score(0) {
-    // Initialize input map
-    m_inputs[PlayerInput::UP] = false;
-    m_inputs[PlayerInput::DOWN] = false;
-    m_inputs[PlayerInput::LEFT] = false;
-    m_inputs[PlayerInput::RIGHT] = false;
-    m_inputs[PlayerInput::FIRE] = false;
+      m_score(0),
+      m_fireInterval(0.2f),
+      m_fireCooldown(0.0f),
+      m_aimDirection(0.0f, -1.0f),
+      m_inputMask(0) {
 }
 
 void Player::update(float deltaTime) {
     // Handle movement based on input
     Vector2 direction(0.0f, 0.0f);
     
-    if (m_inputs[PlayerInput::UP]) {
+    if (isInputPressed(PlayerInput::UP)) {
         direction.y -= 1.0f;
     }
-    if (m_inputs[PlayerInput::DOWN]) {
+    if (isInputPressed(PlayerInput::DOWN)) {
         direction.y += 1.0f;
     }
-    if (m_inputs[PlayerInput::LEFT]) {
+    if (isInputPressed(PlayerInput::LEFT)) {
         direction.x -= 1.0f;
     }
-    if (m_inputs[PlayerInput::RIGHT]) {
+    if (isInputPressed(PlayerInput::RIGHT)) {
         direction.x += 1.0f;
     }
     
     // Normalize direction if moving diagonally
     if (direction.lengthSquared() > 0.0f) {
         direction.normalize();
+        m_aimDirection = direction;
     }
     
-    // Set velocity based on direction and speed
-    m_velocity = direction * m_speed;
+    if (m_fireCooldown > 0.0f) {
+        m_fireCooldown -= deltaTime;
+    }
     
-    // Call parent update to apply movement
-    Entity::update(deltaTime);
+    // Set velocity based on direction and speed
+    setVelocity(direction * m_speed);
 }
 
 void Player::handleCollision(Entity* other) {
     if (other->getType() == EntityType::DRONE) {
-        // Handle collision with drone
-        m_health -= 10.0f;
-        if (m_health <= 0.0f) {
-            setActive(false);
-        }
+        // Called once when the contact begins, not every frame of overlap
+        takeDamage(10.0f);
     } else if (other->getType() == EntityType::POWERUP) {
         // Handle power-up collection
     }
 }
 
 void Player::setInput(PlayerInput input, bool pressed) {
-    m_inputs[input] = pressed;
+    if (pressed) {
+        m_inputMask |= inputBit(input);
+    } else {
+        m_inputMask &= static_cast<uint8_t>(~inputBit(input));
+    }
+}
+
+bool Player::consumeShot() {
+    if (!isInputPressed(PlayerInput::FIRE) || m_fireCooldown > 0.0f) {
+        return false;
+    }
+    m_fireCooldown = m_fireInterval;
+    return true;
+}
+
+void Player::takeDamage(float amount) {
+    m_health -= amount;
+    if (m_health <= 0.0f) {
+        setActive(false);
+    }
 }
 
 void Player::reset() {
@@ -64,3 +81,27 @@ void Player::reset() {
     m_score = 0;
     setActive(true);
 }
+
+void Player::saveState(BinaryWriter& writer) const {
+    Entity::saveState(writer);
+    writer.write(m_speed);
+    writer.write(m_health);
+    writer.write(m_score);
+    writer.write(m_fireInterval);
+    writer.write(m_fireCooldown);
+    writer.write(m_aimDirection.x);
+    writer.write(m_aimDirection.y);
+    writer.write(m_inputMask);
+}
+
+void Player::loadState(BinaryReader& reader) {
+    Entity::loadState(reader);
+    reader.read(m_speed);
+    reader.read(m_health);
+    reader.read(m_score);
+    reader.read(m_fireInterval);
+    reader.read(m_fireCooldown);
+    reader.read(m_aimDirection.x);
+    reader.read(m_aimDirection.y);
+    reader.read(m_inputMask);
+}
@@ -2,7 +2,7 @@
 #pragma once
 
 #include "Entity.h"
-#include <unordered_map>
+#include <cstdint>
 
 enum class PlayerInput {
     UP,
@@ -12,18 +12,37 @@ enum class PlayerInput {
     FIRE
 };
 
-class Player : public Entity {
+class Player final : public Entity {
 public:
-    Player(const Vector2& position);
+    Player(TransformStore& transforms, const Vector2& position);
     virtual void update(float deltaTime) override;
     virtual void handleCollision(Entity* other) override;
     
     void setInput(PlayerInput input, bool pressed);
+    bool isInputPressed(PlayerInput input) const { return (m_inputMask & inputBit(input)) != 0; }
     void reset();
     
+    // Held inputs, one bit per PlayerInput; recorded per tick in replays
+    uint8_t getInputMask() const { return m_inputMask; }
+    void setInputMask(uint8_t mask) { m_inputMask = mask; }
+    static uint8_t inputBit(PlayerInput input) { return static_cast<uint8_t>(1u << static_cast<int>(input)); }
+    
+    // Firing: returns true (and restarts the cooldown) when a shot should spawn
+    bool consumeShot();
+    Vector2 getAimDirection() const { return m_aimDirection; }
+    
+    void takeDamage(float amount);
+    float getHealth() const { return m_health; }
+    
+    virtual void saveState(BinaryWriter& writer) const override;
+    virtual void loadState(BinaryReader& reader) override;
+
 private:
-    std::unordered_map<PlayerInput, bool> m_inputs;
     float m_speed;
     float m_health;
     int m_score;
+    float m_fireInterval;
+    float m_fireCooldown;
+    Vector2 m_aimDirection;
+    uint8_t m_inputMask;
 };
@@ -2,12 +2,54 @@
 #include <emscripten.h>
 #include <emscripten/bind.h>
 #include "Game.h"
+#include "audio/AudioManager.h"
+#include "engine/GameEngine.h"
+#include "profiling/Profiler.h"
+#include "render/DrawList.h"
+#include "replay/ReplayRecorder.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <limits>
 #include <vector>
 #include <memory>
 
 // Global game instance
 static std::unique_ptr<Game> g_game;
 
+// Global mixer, pulled by the AudioWorklet through mixAudio()
+static std::unique_ptr<AudioManager> g_audio;
+
+// Active match recording, written to Emscripten's in-memory filesystem
+static ReplayRecorder g_recorder;
+static const char* const kReplayPath = "/tmp/match.replay";
+
+// Read position of the frontend in the game's event stream
+static uint64_t g_eventCursor = 0;
+
+// Draw list rebuilt on request; JavaScript reads it in place
+static DrawList g_drawList;
+
+// The browser drives a Game directly, so the bindings run the engine's
+// frame governor themselves and keep the last tick's statistics
+static FrameGovernor g_governor;
+static GameStats g_stats;
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+float elapsedMs(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+void applyDegradation() {
+    if (g_game) {
+        GameEngine::applyDegradation(g_governor.getSettings(), *g_game, g_audio.get());
+    }
+}
+}
+
 // Struct for entity data to be passed to JavaScript
 struct EntityData {
     int id;
@@ -19,15 +61,48 @@ struct EntityData {
 
 // Initialize game
 extern "C" EMSCRIPTEN_KEEPALIVE void initGame() {
+    g_recorder.finish();
+    g_eventCursor = 0;
+    g_stats = GameStats();
     g_game = std::make_unique<Game>();
     g_game->initialize();
+    applyDegradation();
 }
 
 // Update game state
 extern "C" EMSCRIPTEN_KEEPALIVE void updateGame(float deltaTime) {
-    if (g_game) {
-        g_game->update(deltaTime);
+    if (!g_game) {
+        return;
+    }
+    
+    PROFILE_BEGIN_FRAME();
+    g_recorder.recordTick(*g_game, deltaTime);
+    Clock::time_point gameStart = Clock::now();
+    g_game->update(deltaTime);
+    Clock::time_point audioStart = Clock::now();
+    if (g_audio) {
+        g_audio->drainEvents(g_game->getEvents());
+        g_audio->update(deltaTime);
+    }
+    Clock::time_point audioEnd = Clock::now();
+    PROFILE_END_FRAME();
+    
+    // Same back-pressure as GameEngine::update(); there is no physics world here
+    g_stats = g_game->getStats();
+    g_stats.gameLogicMs = elapsedMs(gameStart, audioStart);
+    g_stats.audioMs = elapsedMs(audioStart, audioEnd);
+    
+    bool governed = !g_game->isDeterministic();
+    if (governed != g_governor.isEnabled()) {
+        g_governor.setEnabled(governed);
+        applyDegradation();
+    }
+    float phaseMs[static_cast<int>(FramePhase::COUNT)] = {0.0f, g_stats.gameLogicMs, g_stats.audioMs};
+    if (g_governor.update(phaseMs)) {
+        applyDegradation();
     }
+    g_stats.degradationLevel = static_cast<uint32_t>(g_governor.getLevel());
+    g_stats.governedTickMs = g_governor.getTickMs();
 }
 
 // Handle input
@@ -48,7 +123,7 @@ extern "C" EMSCRIPTEN_KEEPALIVE int getGameState() {
 // Get entity data for rendering
 extern "C" EMSCRIPTEN_KEEPALIVE int getEntityCount() {
     if (g_game) {
-        return static_cast<int>(g_game->getEntities().size());
+        return static_cast<int>(g_game->getEntities().size() + g_game->getProjectiles().getCount());
     }
     return 0;
 }
@@ -68,17 +143,178 @@ extern "C" EMSCRIPTEN_KEEPALIVE void getEntityData(EntityData* data, int maxCoun
         data[i].y = entity->getPosition().y;
         data[i].radius = entity->getRadius();
     }
+    
+    // Pooled projectiles follow the entities; they have no entity id
+    const ProjectileSystem& projectiles = g_game->getProjectiles();
+    int projectileCount = std::min(static_cast<int>(projectiles.getCount()), maxCount - count);
+    
+    for (int i = 0; i < projectileCount; ++i) {
+        EntityData& out = data[count + i];
+        Vector2 position = projectiles.getPosition(i);
+        out.id = -1;
+        out.type = static_cast<int>(EntityType::PROJECTILE);
+        out.x = position.x;
+        out.y = position.y;
+        out.radius = projectiles.getRadius(i);
+    }
+}
+
+// Rebuild the draw list, culled to the given rectangle unless it is
+// empty. Returns the number of items; read the layout through
+// getDrawListHeader() and the items through getDrawListItems().
+extern "C" EMSCRIPTEN_KEEPALIVE int buildDrawList(float minX, float minY, float maxX, float maxY) {
+    if (!g_game) {
+        return 0;
+    }
+    
+    DrawViewport viewport;
+    viewport.minX = minX;
+    viewport.minY = minY;
+    viewport.maxX = maxX;
+    viewport.maxY = maxY;
+    viewport.enabled = maxX > minX && maxY > minY;
+    g_drawList.build(*g_game, viewport);
+    return static_cast<int>(g_drawList.getHeader().count);
+}
+
+// Both stay valid until the next buildDrawList()
+extern "C" EMSCRIPTEN_KEEPALIVE const DrawListHeader* getDrawListHeader() {
+    return &g_drawList.getHeader();
+}
+
+extern "C" EMSCRIPTEN_KEEPALIVE const DrawItem* getDrawListItems() {
+    return g_drawList.getItems();
 }
 
 // Get player health
 extern "C" EMSCRIPTEN_KEEPALIVE float getPlayerHealth() {
     if (g_game && g_game->getPlayer()) {
-        // This would need an accessor in Player class
-        return 100.0f; // Placeholder
+        return g_game->getPlayer()->getHealth();
     }
     return 0.0f;
 }
 
+// Create the software mixer at the AudioContext's sample rate
+extern "C" EMSCRIPTEN_KEEPALIVE void initAudio(int sampleRate) {
+    g_audio = std::make_unique<AudioManager>();
+    g_audio->setSampleRate(sampleRate);
+    g_audio->initialize();
+    applyDegradation();
+}
+
+// Register decoded PCM (e.g. from decodeAudioData) under a sound name.
+// Returns the sound's id for playSoundById, or -1 on failure.
+extern "C" EMSCRIPTEN_KEEPALIVE int loadSoundPCM(const char* name, const float* samples, int frames, int channels, int sampleRate) {
+    if (!g_audio || !g_audio->loadSoundFromMemory(name, samples, frames, channels, sampleRate)) {
+        return kInvalidSoundId;
+    }
+    return g_audio->getSoundId(name);
+}
+
+// Play a sound by the id returned from loadSoundPCM
+extern "C" EMSCRIPTEN_KEEPALIVE void playSoundById(int sound, float volume) {
+    if (g_audio) {
+        g_audio->playSound(sound, volume);
+    }
+}
+
+// Set a sound's stealing priority and voice limit
+extern "C" EMSCRIPTEN_KEEPALIVE void setSoundPolicy(int sound, int priority, int maxVoices) {
+    if (g_audio) {
+        g_audio->setSoundPriority(sound, priority);
+        g_audio->setSoundMaxVoices(sound, maxVoices);
+    }
+}
+
+// Play a loaded sound whenever the game emits an event of this type
+extern "C" EMSCRIPTEN_KEEPALIVE void setEventSound(int eventType, int sound, float volume) {
+    if (g_audio) {
+        g_audio->setEventSound(static_cast<GameEventType>(eventType), sound, volume);
+    }
+}
+
+// Record the current match for offline playback in the native build
+extern "C" EMSCRIPTEN_KEEPALIVE bool startReplayRecording() {
+    return g_game && g_recorder.begin(kReplayPath, *g_game);
+}
+
+extern "C" EMSCRIPTEN_KEEPALIVE bool stopReplayRecording() {
+    return g_recorder.finish();
+}
+
+// Copy the last finished recording into a caller-provided buffer.
+// Copies at most capacity bytes and returns the full size, or 0 if the
+// recording cannot be read.
+extern "C" EMSCRIPTEN_KEEPALIVE int getReplayData(void* buffer, int capacity) {
+    if (g_recorder.isRecording()) {
+        return 0;
+    }
+    
+    std::FILE* file = std::fopen(kReplayPath, "rb");
+    if (!file) {
+        return 0;
+    }
+    
+    long size = -1;
+    if (std::fseek(file, 0, SEEK_END) == 0) {
+        size = std::ftell(file);
+    }
+    if (size < 0 || size > std::numeric_limits<int>::max() || std::fseek(file, 0, SEEK_SET) != 0) {
+        std::fclose(file);
+        return 0;
+    }
+    if (buffer && capacity > 0) {
+        size_t count = static_cast<size_t>(std::min(static_cast<long>(capacity), size));
+        if (std::fread(buffer, 1, count, file) != count) {
+            size = 0;
+        }
+    }
+    std::fclose(file);
+    return static_cast<int>(size);
+}
+
+// Copy the gameplay events the frontend has not read yet into a
+// caller-provided array of GameEvent. Returns the number copied; call again
+// while it returns maxCount.
+extern "C" EMSCRIPTEN_KEEPALIVE int drainGameEvents(GameEvent* buffer, int maxCount) {
+    if (!g_game || !buffer || maxCount <= 0) {
+        return 0;
+    }
+    return static_cast<int>(g_game->getEvents().read(g_eventCursor, buffer, static_cast<size_t>(maxCount)));
+}
+
+// Render interleaved stereo frames into a caller-provided buffer
+extern "C" EMSCRIPTEN_KEEPALIVE void mixAudio(float* output, int frames) {
+    if (g_audio) {
+        g_audio->mix(output, frames);
+    } else {
+        std::memset(output, 0, static_cast<size_t>(frames) * 2 * sizeof(float));
+    }
+}
+
+// Copy the runtime statistics into a caller-provided buffer.
+// Copies at most sizeBytes and returns sizeof(GameStats) so callers can
+// detect a layout mismatch.
+extern "C" EMSCRIPTEN_KEEPALIVE int getStats(void* buffer, int sizeBytes) {
+    int size = static_cast<int>(sizeof(GameStats));
+    if (g_game && buffer && sizeBytes > 0) {
+        std::memcpy(buffer, &g_stats, static_cast<size_t>(std::min(size, sizeBytes)));
+    }
+    return size;
+}
+
+// Copy the profiler's Chrome trace JSON into a caller-provided buffer.
+// Returns the full trace length; nothing is written if it does not fit.
+extern "C" EMSCRIPTEN_KEEPALIVE int getProfilerTrace(char* buffer, int capacity) {
+    std::string trace = Profiler::getInstance().getChromeTrace();
+    int length = static_cast<int>(trace.size());
+    
+    if (buffer && capacity > length) {
+        std::memcpy(buffer, trace.c_str(), trace.size() + 1);
+    }
+    return length;
+}
+
 // Using Emscripten's embind for more complex data
 EMSCRIPTEN_BINDINGS(dodgeball_module) {
     emscripten::value_object<EntityData>("EntityData")
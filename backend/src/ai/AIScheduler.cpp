@@ -0,0 +1,154 @@
+// backend/src/ai/AIScheduler.cpp
+#include "AIScheduler.h"
+#include "../Drone.h"
+#include "../profiling/Profiler.h"
+#include <algorithm>
+#include <chrono>
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+float elapsedMs(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration<float, std::milli>(end - start).count();
+}
+}
+
+AIScheduler::AIScheduler()
+    : m_frameBudgetMs(1.0f),
+      m_thinkBudget(0),
+      m_nearDistanceSq(250.0f * 250.0f),
+      m_farDistanceSq(500.0f * 500.0f),
+      m_lodIntervals{0.0f, 1.0f / 15.0f, 0.25f},
+      m_lodScale(1.0f),
+      m_cursor(0) {
+}
+
+void AIScheduler::setLodDistances(float nearDistance, float farDistance) {
+    m_nearDistanceSq = nearDistance * nearDistance;
+    m_farDistanceSq = farDistance * farDistance;
+}
+
+void AIScheduler::setLodIntervals(float nearInterval, float mediumInterval, float farInterval) {
+    m_lodIntervals[0] = nearInterval;
+    m_lodIntervals[1] = mediumInterval;
+    m_lodIntervals[2] = farInterval;
+}
+
+void AIScheduler::resetStats() {
+    m_stats = AIStats();
+}
+
+AILod AIScheduler::classify(const Drone& drone, const AIContext& context) const {
+    Vector2 position = drone.getPosition();
+    
+    // Off-screen drones always get the lowest level of detail
+    if (position.x < context.viewMin.x || position.y < context.viewMin.y ||
+        position.x > context.viewMax.x || position.y > context.viewMax.y) {
+        return AILod::FAR;
+    }
+    
+    if (!context.hasPlayer) {
+        return AILod::MEDIUM;
+    }
+    
+    float distanceSq = (position - context.playerPosition).lengthSquared();
+    if (distanceSq * m_lodScale * m_lodScale < m_nearDistanceSq) {
+        return AILod::NEAR;
+    }
+    return distanceSq < m_farDistanceSq ? AILod::MEDIUM : AILod::FAR;
+}
+
+void AIScheduler::update(const DroneGroups& drones, const AIContext& context, float deltaTime) {
+    PROFILE_ZONE("AIScheduler::update");
+    
+    m_stats.thinksRun = 0;
+    m_stats.thinksDeferred = 0;
+    m_stats.frameCostMs = 0.0f;
+    for (int& count : m_stats.dronesByLod) {
+        count = 0;
+    }
+    
+    size_t count = 0;
+    for (const auto& group : drones) {
+        count += group.size();
+    }
+    if (count == 0) {
+        return;
+    }
+    
+    Pass pass;
+    pass.context = &context;
+    pass.deltaTime = deltaTime;
+    pass.droneCount = count;
+    pass.start = Clock::now();
+    pass.budgetExhausted = false;
+    
+    // Walk every drone once, starting where the previous frame stopped
+    size_t start = m_cursor < count ? m_cursor : 0;
+    runRange(drones, start, count, pass);
+    runRange(drones, 0, start, pass);
+    
+    if (m_stats.thinksDeferred > 0) {
+        m_stats.budgetOverruns++;
+    } else {
+        m_cursor = 0;
+    }
+    
+    m_stats.frameCostMs = elapsedMs(pass.start, Clock::now());
+}
+
+void AIScheduler::runRange(const DroneGroups& drones, size_t begin, size_t end, Pass& pass) {
+    static_assert(kDroneTypeCount == 3, "One runGroup call per DroneType");
+    const auto& chasers = drones[static_cast<int>(DroneType::CHASER)];
+    const auto& patrollers = drones[static_cast<int>(DroneType::PATROLLER)];
+    const auto& shooters = drones[static_cast<int>(DroneType::SHOOTER)];
+    runGroup<DroneType::CHASER>(chasers, 0, begin, end, pass);
+    runGroup<DroneType::PATROLLER>(patrollers, chasers.size(), begin, end, pass);
+    runGroup<DroneType::SHOOTER>(shooters, chasers.size() + patrollers.size(), begin, end, pass);
+}
+
+template<DroneType Type>
+void AIScheduler::runGroup(const std::vector<Drone*>& group, size_t base, size_t begin, size_t end, Pass& pass) {
+    size_t first = begin > base ? begin - base : 0;
+    size_t last = std::min(end > base ? end - base : 0, group.size());
+    const int type = static_cast<int>(Type);
+    
+    for (size_t i = first; i < last; ++i) {
+        Drone* drone = group[i];
+        if (!drone->isActive()) {
+            continue;
+        }
+        
+        drone->accumulateThinkTime(pass.deltaTime);
+        
+        AILod lod = classify(*drone, *pass.context);
+        m_stats.dronesByLod[static_cast<int>(lod)]++;
+        
+        bool due = !drone->hasThought() || drone->getTimeSinceThink() >= m_lodIntervals[static_cast<int>(lod)] * m_lodScale;
+        if (!due) {
+            continue;
+        }
+        
+        if (pass.budgetExhausted) {
+            m_stats.thinksDeferred++;
+            continue;
+        }
+        
+        Clock::time_point thinkStart = Clock::now();
+        drone->think<Type>(*pass.context);
+        Clock::time_point thinkEnd = Clock::now();
+        
+        m_stats.costMsByType[type] += elapsedMs(thinkStart, thinkEnd);
+        m_stats.thinksByType[type]++;
+        m_stats.thinksRun++;
+        
+        // At least one decision runs per frame so nothing starves
+        bool overBudget = m_thinkBudget > 0
+            ? m_stats.thinksRun >= m_thinkBudget
+            : elapsedMs(pass.start, thinkEnd) >= m_frameBudgetMs;
+        if (overBudget) {
+            pass.budgetExhausted = true;
+            m_cursor = (base + i + 1) % pass.droneCount;
+        }
+    }
+}
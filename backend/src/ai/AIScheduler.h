@@ -0,0 +1,120 @@
+// backend/src/ai/AIScheduler.h
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+#include "../vector2.h"
+
+class Drone;
+class ProjectileSystem;
+enum class DroneType;
+
+// Number of DroneType values tracked in per-type statistics
+constexpr int kDroneTypeCount = 3;
+
+// A game's drones split by DroneType, indexed by the type
+using DroneGroups = std::array<std::vector<Drone*>, kDroneTypeCount>;
+
+// World information handed to drones when they make decisions
+struct AIContext {
+    Vector2 playerPosition;
+    bool hasPlayer = false;
+    
+    // Visible area; drones outside it are treated as off-screen
+    Vector2 viewMin;
+    Vector2 viewMax;
+    
+    // Where drones spawn their shots; may be null
+    ProjectileSystem* projectiles = nullptr;
+};
+
+// Level of detail for drone decision making
+enum class AILod {
+    NEAR,      // Think every tick
+    MEDIUM,    // Think every few ticks
+    FAR        // Far from the player or off-screen
+};
+
+// Per-frame and cumulative scheduler statistics
+struct AIStats {
+    int thinksRun = 0;           // Decisions made this frame
+    int thinksDeferred = 0;      // Due decisions pushed to a later frame
+    float frameCostMs = 0.0f;    // Time spent in decisions this frame
+    
+    int dronesByLod[3] = {0, 0, 0};
+    
+    // Cumulative counters since the last reset
+    unsigned int budgetOverruns = 0;
+    double costMsByType[kDroneTypeCount] = {0.0, 0.0, 0.0};
+    unsigned int thinksByType[kDroneTypeCount] = {0, 0, 0};
+};
+
+// Spreads expensive drone decisions (retargeting, firing, patrol changes)
+// across frames under a per-frame time budget. Movement integration is not
+// scheduled here; it still runs every tick in Drone::update.
+class AIScheduler {
+public:
+    AIScheduler();
+    
+    // Run the decisions that are due this frame. Each type's group runs
+    // its own decision kernel, called directly rather than per drone.
+    void update(const DroneGroups& drones, const AIContext& context, float deltaTime);
+    
+    // Configuration
+    void setFrameBudget(float milliseconds) { m_frameBudgetMs = milliseconds; }
+    float getFrameBudget() const { return m_frameBudgetMs; }
+    
+    // Cap decisions per frame by count instead of wall time. The time budget
+    // depends on the machine, so replays record with a count budget;
+    // zero switches back to the time budget.
+    void setThinkBudget(int thinksPerFrame) { m_thinkBudget = thinksPerFrame; }
+    int getThinkBudget() const { return m_thinkBudget; }
+    
+    // Round-robin position; saved with replay keyframes
+    size_t getCursor() const { return m_cursor; }
+    void setCursor(size_t cursor) { m_cursor = cursor; }
+    void setLodDistances(float nearDistance, float farDistance);
+    void setLodIntervals(float nearInterval, float mediumInterval, float farInterval);
+    
+    // Above 1, drones think less often: the near ring shrinks and the
+    // medium and far intervals stretch by this factor
+    void setLodScale(float scale) { m_lodScale = scale; }
+    float getLodScale() const { return m_lodScale; }
+    
+    // Statistics
+    const AIStats& getStats() const { return m_stats; }
+    void resetStats();
+
+private:
+    float m_frameBudgetMs;
+    int m_thinkBudget;
+    float m_nearDistanceSq;
+    float m_farDistanceSq;
+    float m_lodIntervals[3];
+    float m_lodScale;
+    
+    // Round-robin position so deferred drones are served first next frame;
+    // counts through the groups laid end to end in type order
+    size_t m_cursor;
+    
+    AIStats m_stats;
+    
+    // State of one update() pass
+    struct Pass {
+        const AIContext* context;
+        float deltaTime;
+        size_t droneCount;
+        std::chrono::steady_clock::time_point start;
+        bool budgetExhausted;
+    };
+    
+    AILod classify(const Drone& drone, const AIContext& context) const;
+    void runRange(const DroneGroups& drones, size_t begin, size_t end, Pass& pass);
+    
+    // Drones [begin, end) of the whole sequence that fall in one group,
+    // which starts at position base
+    template<DroneType Type>
+    void runGroup(const std::vector<Drone*>& group, size_t base, size_t begin, size_t end, Pass& pass);
+};
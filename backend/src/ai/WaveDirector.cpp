@@ -0,0 +1,141 @@
+// backend/src/ai/WaveDirector.cpp
+#include "WaveDirector.h"
+#include "../replay/BinaryStream.h"
+#include <algorithm>
+
+namespace {
+// CHASER, PATROLLER, SHOOTER
+constexpr WaveDefinition kWaves[] = {
+    {0.0f, {3, 1, 1}},
+    {8.0f, {4, 2, 1}},
+    {10.0f, {6, 3, 2}},
+    {12.0f, {8, 4, 4}},
+    {15.0f, {12, 6, 6}},
+    {18.0f, {20, 8, 8}},
+};
+constexpr int kWaveCount = sizeof(kWaves) / sizeof(kWaves[0]);
+
+// Drones of each type added every time the last wave repeats
+const int kEscalation = 2;
+}
+
+WaveDirector::WaveDirector()
+    : m_spawnBudget(4),
+      m_maxLiveDrones(64),
+      m_prewarmLead(2.0f) {
+    reset();
+}
+
+void WaveDirector::reset() {
+    m_wave = 0;
+    m_untilNextWave = kWaves[0].delay;
+    m_prewarmed = false;
+    m_prewarmCount = 0;
+    std::fill(m_pending, m_pending + kDroneTypeCount, 0);
+    m_nextType = 0;
+}
+
+WaveDefinition WaveDirector::getWaveDefinition(int wave) {
+    if (wave < kWaveCount) {
+        return kWaves[wave];
+    }
+    
+    WaveDefinition definition = kWaves[kWaveCount - 1];
+    int repeats = wave - kWaveCount + 1;
+    for (int& count : definition.drones) {
+        count += repeats * kEscalation;
+    }
+    return definition;
+}
+
+int WaveDirector::getPendingCount() const {
+    int pending = 0;
+    for (int count : m_pending) {
+        pending += count;
+    }
+    return pending;
+}
+
+void WaveDirector::startWave() {
+    WaveDefinition definition = getWaveDefinition(m_wave);
+    for (int type = 0; type < kDroneTypeCount; ++type) {
+        m_pending[type] += definition.drones[type];
+    }
+    m_wave++;
+    m_untilNextWave += getWaveDefinition(m_wave).delay;
+    m_prewarmed = false;
+}
+
+int WaveDirector::update(float deltaTime, int liveDrones, SpawnRequest* requests) {
+    m_untilNextWave -= deltaTime;
+    while (m_untilNextWave <= 0.0f) {
+        startWave();
+    }
+    
+    if (!m_prewarmed && m_untilNextWave <= m_prewarmLead) {
+        m_prewarmed = true;
+        WaveDefinition next = getWaveDefinition(m_wave);
+        for (int count : next.drones) {
+            m_prewarmCount += count;
+        }
+    }
+    
+    // Hand out queued drones one type at a time until the budget or the cap runs out
+    int room = std::min(m_spawnBudget, m_maxLiveDrones - liveDrones);
+    int counts[kDroneTypeCount] = {};
+    int type = m_nextType;
+    for (int empty = 0; room > 0 && empty < kDroneTypeCount; type = (type + 1) % kDroneTypeCount) {
+        if (m_pending[type] > 0) {
+            m_pending[type]--;
+            counts[type]++;
+            room--;
+            empty = 0;
+        } else {
+            empty++;
+        }
+    }
+    m_nextType = type;
+    
+    int used = 0;
+    for (int i = 0; i < kDroneTypeCount; ++i) {
+        if (counts[i] > 0) {
+            requests[used++] = {static_cast<DroneType>(i), counts[i]};
+        }
+    }
+    return used;
+}
+
+int WaveDirector::takePrewarm() {
+    int count = m_prewarmCount;
+    m_prewarmCount = 0;
+    return count;
+}
+
+void WaveDirector::saveState(BinaryWriter& writer) const {
+    writer.write(static_cast<int32_t>(m_wave));
+    writer.write(m_untilNextWave);
+    writer.write(static_cast<uint8_t>(m_prewarmed));
+    for (int count : m_pending) {
+        writer.write(static_cast<int32_t>(count));
+    }
+    writer.write(static_cast<int32_t>(m_nextType));
+}
+
+bool WaveDirector::loadState(BinaryReader& reader) {
+    m_wave = reader.read<int32_t>();
+    reader.read(m_untilNextWave);
+    m_prewarmed = reader.read<uint8_t>() != 0;
+    m_prewarmCount = 0;
+    bool valid = m_wave >= 0;
+    for (int& count : m_pending) {
+        count = reader.read<int32_t>();
+        valid = valid && count >= 0;
+    }
+    m_nextType = reader.read<int32_t>();
+    valid = valid && !reader.failed() && m_untilNextWave >= 0.0f &&
+            m_nextType >= 0 && m_nextType < kDroneTypeCount;
+    if (!valid) {
+        reset();
+    }
+    return valid;
+}
@@ -0,0 +1,74 @@
+// backend/src/ai/WaveDirector.h
+#pragma once
+
+#include "AIScheduler.h"
+#include "../Drone.h"
+
+class BinaryWriter;
+class BinaryReader;
+
+// One row of the wave schedule
+struct WaveDefinition {
+    float delay;                        // Seconds after the previous wave starts
+    int drones[kDroneTypeCount];        // Drones of each DroneType
+};
+
+// Drones of one type to spawn this frame
+struct SpawnRequest {
+    DroneType type;
+    int count;
+};
+
+// Starts drone waves from a data table and feeds their drones to the game
+// a few per frame. A wave that starts while earlier drones are still queued
+// adds to the queue, and nothing spawns while the live cap is reached, so
+// a big wave costs the same per frame as a small one. Shortly before each
+// wave the director reports its size once so storage can be reserved
+// ahead of time. Past the end of the table the last wave repeats, growing
+// each time.
+class WaveDirector {
+public:
+    WaveDirector();
+    
+    // Back to before the first wave, which starts on the next update()
+    void reset();
+    
+    // Advance the schedule. Fills requests (room for kDroneTypeCount) with
+    // this frame's spawns and returns how many entries it used.
+    int update(float deltaTime, int liveDrones, SpawnRequest* requests);
+    
+    // Size of the next wave, reported once within the prewarm lead; 0 otherwise
+    int takePrewarm();
+    
+    // Configuration
+    void setSpawnBudget(int dronesPerFrame) { m_spawnBudget = dronesPerFrame; }
+    int getSpawnBudget() const { return m_spawnBudget; }
+    void setMaxLiveDrones(int maxLiveDrones) { m_maxLiveDrones = maxLiveDrones; }
+    int getMaxLiveDrones() const { return m_maxLiveDrones; }
+    void setPrewarmLead(float seconds) { m_prewarmLead = seconds; }
+    
+    // Waves started so far, and drones still queued
+    int getWave() const { return m_wave; }
+    int getPendingCount() const;
+    
+    void saveState(BinaryWriter& writer) const;
+    bool loadState(BinaryReader& reader);
+    
+    static WaveDefinition getWaveDefinition(int wave);
+
+private:
+    int m_wave;
+    float m_untilNextWave;
+    bool m_prewarmed;
+    int m_prewarmCount;
+    int m_pending[kDroneTypeCount];
+    
+    // Type served first next frame, so one type cannot starve the others
+    int m_nextType;
+    
+    int m_spawnBudget;
+    int m_maxLiveDrones;
+    float m_prewarmLead;
+    
+    void startWave();
+};
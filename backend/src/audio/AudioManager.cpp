@@ -1,175 +1,534 @@
-// backend/src/physics/PhysicsWorld.cpp
-#include "PhysicsWorld.h"
-#include "../include/Entity.h"
+// backend/src/audio/AudioManager.cpp
+#include "AudioManager.h"
+#include "../profiling/Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 
-// Contact listener implementation
-PhysicsWorld::ContactListener::ContactListener(PhysicsWorld* physicsWorld)
-    : m_physicsWorld(physicsWorld) {
+namespace {
+uint32_t readU32(const unsigned char* data) {
+    return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24);
 }
 
-void PhysicsWorld::ContactListener::BeginContact(b2Contact* contact) {
-    // Get the entities from the fixtures' user data
-    b2Body* bodyA = contact->GetFixtureA()->GetBody();
-    b2Body* bodyB = contact->GetFixtureB()->GetBody();
+uint16_t readU16(const unsigned char* data) {
+    return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+}
+
+AudioManager::AudioManager()
+    : m_bufferCount(0),
+      m_droppedCommands(0),
+      m_requestsThisFrame{},
+      m_coalescedPlays(0),
+      m_voiceLimit(kMaxVoices),
+      m_eventCursor(0),
+      m_droppedEvents(0),
+      m_mixerVoiceLimit(kMaxVoices),
+      m_nextStartOrder(0),
+      m_stolenVoices(0),
+      m_rejectedPlays(0),
+      m_soundGain(1.0f),
+      m_musicGain(1.0f),
+      m_activeVoices(0),
+      m_mixerRunning(false),
+#ifdef __EMSCRIPTEN__
+      m_useMixerThread(false),
+#else
+      m_useMixerThread(true),
+#endif
+      m_sampleRate(48000),
+      m_soundVolume(1.0f),
+      m_musicVolume(1.0f),
+      m_soundsMuted(false),
+      m_musicMuted(false),
+      m_initialized(false) {
+}
+
+AudioManager::~AudioManager() {
+    shutdown();
+}
+
+bool AudioManager::initialize() {
+    if (m_initialized) {
+        return true;
+    }
     
-    auto itA = m_physicsWorld->m_bodyEntityMap.find(bodyA);
-    auto itB = m_physicsWorld->m_bodyEntityMap.find(bodyB);
+    m_initialized = true;
+    updateGains();
     
-    if (itA != m_physicsWorld->m_bodyEntityMap.end() && itB != m_physicsWorld->m_bodyEntityMap.end()) {
-        Entity* entityA = itA->second;
-        Entity* entityB = itB->second;
-        
-        // Notify entities of collision
-        if (entityA && entityB) {
-            entityA->handleCollision(entityB);
-            entityB->handleCollision(entityA);
-        }
+    // Native builds render on their own thread; in WebAssembly the
+    // AudioWorklet pulls blocks through mix() instead
+    if (m_useMixerThread) {
+        m_mixerRunning.store(true);
+        m_mixerThread = std::thread(&AudioManager::mixerThreadMain, this);
+    }
+    
+    return true;
+}
+
+void AudioManager::shutdown() {
+    if (m_mixerRunning.exchange(false) && m_mixerThread.joinable()) {
+        m_mixerThread.join();
     }
+    m_initialized = false;
 }
 
-void PhysicsWorld::ContactListener::EndContact(b2Contact* contact) {
-    // Handle end of contact if needed
+void AudioManager::update(float /*deltaTime*/) {
+    PROFILE_ZONE("AudioManager::update");
+    
+    // Mixing happens on the consumer side; the game thread only starts a
+    // new frame of play-request coalescing
+    std::fill(std::begin(m_requestsThisFrame), std::end(m_requestsThisFrame), 0);
 }
 
-// PhysicsWorld implementation
-PhysicsWorld::PhysicsWorld(float gravity)
-    : m_world(std::make_unique<b2World>(b2Vec2(0.0f, gravity))),
-      m_timeStep(1.0f / 60.0f),
-      m_velocityIterations(8),
-      m_positionIterations(3) {
+void AudioManager::playSound(SoundId sound, float volume) {
+    if (sound < 0 || sound >= m_bufferCount.load(std::memory_order_relaxed)) {
+        return;
+    }
+    
+    // More requests than the sound may ever have voices add nothing audible
+    if (m_requestsThisFrame[sound] >= m_policies[sound].maxVoices) {
+        m_coalescedPlays++;
+        return;
+    }
+    m_requestsThisFrame[sound]++;
     
-    // Set up contact listener
-    m_contactListener = std::make_unique<ContactListener>(this);
-    m_world->SetContactListener(m_contactListener.get());
+    sendCommand({CommandType::PLAY_SOUND, sound, volume, false, SoundPolicy()});
+}
+
+void AudioManager::stopSound(SoundId sound) {
+    if (sound >= 0) {
+        sendCommand({CommandType::STOP_SOUND, sound, 0.0f, false, SoundPolicy()});
+    }
 }
 
-PhysicsWorld::~PhysicsWorld() {
-    // Clean up all bodies
-    b2Body* body = m_world->GetBodyList();
-    while (body) {
-        b2Body* nextBody = body->GetNext();
-        m_world->DestroyBody(body);
-        body = nextBody;
+void AudioManager::playSound(const std::string& name) {
+    playSound(getSoundId(name));
+}
+
+void AudioManager::stopSound(const std::string& name) {
+    stopSound(getSoundId(name));
+}
+
+void AudioManager::stopAllSounds() {
+    sendCommand({CommandType::STOP_ALL_SOUNDS, -1, 0.0f, false, SoundPolicy()});
+}
+
+void AudioManager::playMusic(SoundId sound, bool loop) {
+    if (sound >= 0) {
+        sendCommand({CommandType::PLAY_MUSIC, sound, 1.0f, loop, SoundPolicy()});
     }
 }
 
-void PhysicsWorld::update(float deltaTime) {
-    // Step the simulation
-    m_world->Step(m_timeStep, m_velocityIterations, m_positionIterations);
+void AudioManager::playMusic(const std::string& name, bool loop) {
+    playMusic(getSoundId(name), loop);
+}
+
+void AudioManager::stopMusic() {
+    sendCommand({CommandType::STOP_MUSIC, -1, 0.0f, false, SoundPolicy()});
+}
+
+void AudioManager::setSoundPriority(SoundId sound, int priority) {
+    if (sound < 0 || sound >= kMaxSounds) {
+        return;
+    }
+    m_policies[sound].priority = priority;
+    sendCommand({CommandType::SET_SOUND_POLICY, sound, 0.0f, false, m_policies[sound]});
+}
+
+void AudioManager::setSoundMaxVoices(SoundId sound, int maxVoices) {
+    if (sound < 0 || sound >= kMaxSounds) {
+        return;
+    }
+    m_policies[sound].maxVoices = std::max(maxVoices, 1);
+    sendCommand({CommandType::SET_SOUND_POLICY, sound, 0.0f, false, m_policies[sound]});
+}
+
+void AudioManager::setVoiceLimit(int voices) {
+    voices = std::min(std::max(voices, 1), kMaxVoices);
+    if (voices == m_voiceLimit) {
+        return;
+    }
     
-    // Update entity positions from physics bodies
-    for (auto& pair : m_bodyEntityMap) {
-        b2Body* body = pair.first;
-        Entity* entity = pair.second;
-        
-        if (body && entity) {
-            updateEntityFromBody(entity, body);
+    m_voiceLimit = voices;
+    sendCommand({CommandType::SET_VOICE_LIMIT, -1, 0.0f, false, SoundPolicy(), voices});
+}
+
+void AudioManager::setEventSound(GameEventType type, SoundId sound, float volume) {
+    int index = static_cast<int>(type);
+    if (index < 0 || index >= static_cast<int>(GameEventType::COUNT)) {
+        return;
+    }
+    m_eventSounds[index].sound = sound;
+    m_eventSounds[index].volume = volume;
+}
+
+void AudioManager::drainEvents(const GameEventBus& events) {
+    PROFILE_ZONE("AudioManager::drainEvents");
+    
+    GameEvent batch[64];
+    uint64_t dropped = 0;
+    size_t count = events.read(m_eventCursor, batch, 64, &dropped);
+    m_droppedEvents += dropped;
+    while (count > 0) {
+        for (size_t i = 0; i < count; ++i) {
+            const EventSound& binding = m_eventSounds[static_cast<int>(batch[i].type)];
+            if (binding.sound != kInvalidSoundId) {
+                playSound(binding.sound, binding.volume);
+            }
         }
+        count = events.read(m_eventCursor, batch, 64);
     }
 }
 
-void PhysicsWorld::setGravity(float gravity) {
-    m_world->SetGravity(b2Vec2(0.0f, gravity));
+void AudioManager::setSoundVolume(float volume) {
+    m_soundVolume = std::min(std::max(volume, 0.0f), 1.0f);
+    updateGains();
+}
+
+void AudioManager::setMusicVolume(float volume) {
+    m_musicVolume = std::min(std::max(volume, 0.0f), 1.0f);
+    updateGains();
+}
+
+void AudioManager::muteSounds(bool mute) {
+    m_soundsMuted = mute;
+    updateGains();
 }
 
-b2Body* PhysicsWorld::createBody(Entity* entity, bool isDynamic) {
-    if (!entity) {
-        return nullptr;
+void AudioManager::muteMusic(bool mute) {
+    m_musicMuted = mute;
+    updateGains();
+}
+
+void AudioManager::updateGains() {
+    sendCommand({CommandType::SET_SOUND_GAIN, -1, m_soundsMuted ? 0.0f : m_soundVolume, false, SoundPolicy()});
+    sendCommand({CommandType::SET_MUSIC_GAIN, -1, m_musicMuted ? 0.0f : m_musicVolume, false, SoundPolicy()});
+}
+
+bool AudioManager::loadSound(const std::string& name, const std::string& filePath) {
+    auto it = m_soundResources.find(name);
+    if (it != m_soundResources.end() && it->second.loaded) {
+        return true;
+    }
+    
+    SoundBuffer buffer;
+    if (!decodeWav(filePath, buffer)) {
+        return false;
     }
     
-    // Create body definition
-    b2BodyDef bodyDef;
-    bodyDef.type = isDynamic ? b2_dynamicBody : b2_staticBody;
-    bodyDef.position.Set(entity->getPosition().x, entity->getPosition().y);
-    bodyDef.linearDamping = 0.5f;
-    bodyDef.angularDamping = 0.5f;
+    int bufferIndex = addBuffer(std::move(buffer));
+    if (bufferIndex < 0) {
+        return false;
+    }
     
-    // Create body
-    b2Body* body = m_world->CreateBody(&bodyDef);
+    m_soundResources[name] = {filePath, bufferIndex, true};
+    return true;
+}
+
+bool AudioManager::loadMusic(const std::string& name, const std::string& filePath) {
+    // Music is mixed from the same preloaded buffers on a dedicated voice
+    return loadSound(name, filePath);
+}
+
+bool AudioManager::loadSoundFromMemory(const std::string& name, const float* samples, int frames, int channels, int sampleRate) {
+    if (!samples || frames <= 0 || channels < 1 || channels > 2 || sampleRate <= 0) {
+        return false;
+    }
     
-    // Create circular fixture for the body
-    b2CircleShape circleShape;
-    circleShape.m_radius = entity->getRadius();
+    // The mixer may be reading the existing buffer, so it is kept rather than replaced
+    auto it = m_soundResources.find(name);
+    if (it != m_soundResources.end() && it->second.loaded) {
+        return true;
+    }
     
-    b2FixtureDef fixtureDef;
-    fixtureDef.shape = &circleShape;
-    fixtureDef.density = 1.0f;
-    fixtureDef.friction = 0.3f;
-    fixtureDef.restitution = 0.5f; // Bouncy
+    SoundBuffer buffer;
+    buffer.samples.assign(samples, samples + static_cast<size_t>(frames) * channels);
+    buffer.frames = frames;
+    buffer.channels = channels;
+    buffer.sampleRate = sampleRate;
     
-    body->CreateFixture(&fixtureDef);
+    int bufferIndex = addBuffer(std::move(buffer));
+    if (bufferIndex < 0) {
+        return false;
+    }
     
-    // Store entity reference
-    m_bodyEntityMap[body] = entity;
+    m_soundResources[name] = {std::string(), bufferIndex, true};
+    return true;
+}
+
+int AudioManager::addBuffer(SoundBuffer&& buffer) {
+    int bufferIndex = m_bufferCount.load(std::memory_order_relaxed);
+    if (bufferIndex >= kMaxSounds) {
+        return -1;
+    }
     
-    return body;
+    // Fill the slot first, then publish it to the mixer
+    m_buffers[bufferIndex] = std::move(buffer);
+    m_bufferCount.store(bufferIndex + 1, std::memory_order_release);
+    return bufferIndex;
 }
 
-void PhysicsWorld::removeBody(b2Body* body) {
-    if (body) {
-        // Remove from map
-        m_bodyEntityMap.erase(body);
-        
-        // Destroy body
-        m_world->DestroyBody(body);
+SoundId AudioManager::getSoundId(const std::string& name) const {
+    auto it = m_soundResources.find(name);
+    if (it == m_soundResources.end() || !it->second.loaded) {
+        return -1;
     }
+    return it->second.bufferIndex;
 }
 
-void PhysicsWorld::updateEntityFromBody(Entity* entity, b2Body* body) {
-    if (entity && body) {
-        // Update entity position from body
-        b2Vec2 position = body->GetPosition();
-        entity->setPosition(Vector2(position.x, position.y));
-        
-        // Update velocity
-        b2Vec2 velocity = body->GetLinearVelocity();
-        entity->setVelocity(Vector2(velocity.x, velocity.y));
+void AudioManager::sendCommand(const Command& command) {
+    // Never block the game loop; a full queue drops the command
+    if (!m_commands.push(command)) {
+        m_droppedCommands++;
     }
 }
 
-Vector2 PhysicsWorld::getBodyPosition(b2Body* body) const {
-    if (body) {
-        b2Vec2 position = body->GetPosition();
-        return Vector2(position.x, position.y);
+void AudioManager::applyCommand(const Command& command) {
+    switch (command.type) {
+        case CommandType::PLAY_SOUND:
+            startSoundVoice(command.bufferIndex, command.value);
+            break;
+        case CommandType::STOP_SOUND:
+            for (Voice& voice : m_voices) {
+                if (voice.active && voice.bufferIndex == command.bufferIndex) {
+                    voice.active = false;
+                }
+            }
+            break;
+        case CommandType::STOP_ALL_SOUNDS:
+            for (Voice& voice : m_voices) {
+                voice.active = false;
+            }
+            break;
+        case CommandType::PLAY_MUSIC:
+            startVoice(m_musicVoice, command.bufferIndex, command.value, command.loop);
+            break;
+        case CommandType::STOP_MUSIC:
+            m_musicVoice.active = false;
+            break;
+        case CommandType::SET_SOUND_GAIN:
+            m_soundGain = command.value;
+            break;
+        case CommandType::SET_MUSIC_GAIN:
+            m_musicGain = command.value;
+            break;
+        case CommandType::SET_SOUND_POLICY:
+            m_mixerPolicies[command.bufferIndex] = command.policy;
+            break;
+        case CommandType::SET_VOICE_LIMIT:
+            m_mixerVoiceLimit = command.voiceLimit;
+            for (int i = m_mixerVoiceLimit; i < kMaxVoices; ++i) {
+                m_voices[i].active = false;
+            }
+            break;
     }
-    return Vector2();
 }
 
-void PhysicsWorld::setBodyPosition(b2Body* body, const Vector2& position) {
-    if (body) {
-        body->SetTransform(b2Vec2(position.x, position.y), body->GetAngle());
+void AudioManager::startSoundVoice(int bufferIndex, float volume) {
+    const SoundPolicy& policy = m_mixerPolicies[bufferIndex];
+    
+    Voice* freeVoice = nullptr;
+    Voice* oldestSame = nullptr;
+    Voice* victim = nullptr;
+    int sameCount = 0;
+    
+    for (int i = 0; i < m_mixerVoiceLimit; ++i) {
+        Voice& voice = m_voices[i];
+        if (!voice.active) {
+            if (!freeVoice) {
+                freeVoice = &voice;
+            }
+            continue;
+        }
+        
+        if (voice.bufferIndex == bufferIndex) {
+            sameCount++;
+            if (!oldestSame || voice.startOrder < oldestSame->startOrder) {
+                oldestSame = &voice;
+            }
+        }
+        
+        // Steal candidates: lowest priority first, then oldest
+        if (!victim || voice.priority < victim->priority ||
+            (voice.priority == victim->priority && voice.startOrder < victim->startOrder)) {
+            victim = &voice;
+        }
+    }
+    
+    Voice* target = nullptr;
+    if (sameCount >= policy.maxVoices) {
+        // At the per-sound limit: restart this sound's oldest voice
+        target = oldestSame;
+        m_stolenVoices.fetch_add(1, std::memory_order_relaxed);
+    } else if (freeVoice) {
+        target = freeVoice;
+    } else if (victim && victim->priority <= policy.priority) {
+        target = victim;
+        m_stolenVoices.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        m_rejectedPlays.fetch_add(1, std::memory_order_relaxed);
+        return;
     }
+    
+    startVoice(*target, bufferIndex, volume, false);
+    target->priority = policy.priority;
 }
 
-Vector2 PhysicsWorld::getBodyVelocity(b2Body* body) const {
-    if (body) {
-        b2Vec2 velocity = body->GetLinearVelocity();
-        return Vector2(velocity.x, velocity.y);
+void AudioManager::startVoice(Voice& voice, int bufferIndex, float volume, bool loop) {
+    if (bufferIndex < 0 || bufferIndex >= m_bufferCount.load(std::memory_order_acquire)) {
+        return;
     }
-    return Vector2();
+    
+    voice.bufferIndex = bufferIndex;
+    voice.position = 0.0;
+    voice.step = static_cast<double>(m_buffers[bufferIndex].sampleRate) / m_sampleRate;
+    voice.volume = volume;
+    voice.loop = loop;
+    voice.startOrder = m_nextStartOrder++;
+    voice.active = true;
 }
 
-void PhysicsWorld::setBodyVelocity(b2Body* body, const Vector2& velocity) {
-    if (body) {
-        body->SetLinearVelocity(b2Vec2(velocity.x, velocity.y));
+void AudioManager::mix(float* output, int frames) {
+    // Apply everything the game thread queued since the last block
+    Command command;
+    while (m_commands.pop(command)) {
+        applyCommand(command);
+    }
+    
+    std::fill(output, output + static_cast<size_t>(frames) * 2, 0.0f);
+    
+    int active = 0;
+    for (Voice& voice : m_voices) {
+        if (voice.active) {
+            mixVoice(voice, m_soundGain, output, frames);
+            active++;
+        }
     }
+    if (m_musicVoice.active) {
+        mixVoice(m_musicVoice, m_musicGain, output, frames);
+    }
+    
+    m_activeVoices.store(active, std::memory_order_relaxed);
 }
 
-float PhysicsWorld::getBodyAngle(b2Body* body) const {
-    if (body) {
-        return body->GetAngle();
+void AudioManager::mixVoice(Voice& voice, float gain, float* output, int frames) {
+    const SoundBuffer& buffer = m_buffers[voice.bufferIndex];
+    const float* samples = buffer.samples.data();
+    int channels = buffer.channels;
+    float volume = voice.volume * gain;
+    
+    for (int frame = 0; frame < frames; ++frame) {
+        // Linear interpolation between neighbouring source frames
+        int index = static_cast<int>(voice.position);
+        float fraction = static_cast<float>(voice.position - index);
+        int next = index + 1 < buffer.frames ? index + 1 : (voice.loop ? 0 : index);
+        
+        const float* a = samples + static_cast<size_t>(index) * channels;
+        const float* b = samples + static_cast<size_t>(next) * channels;
+        float left = a[0] + (b[0] - a[0]) * fraction;
+        float right = channels > 1 ? a[1] + (b[1] - a[1]) * fraction : left;
+        
+        output[frame * 2] += left * volume;
+        output[frame * 2 + 1] += right * volume;
+        
+        voice.position += voice.step;
+        if (voice.position >= buffer.frames) {
+            if (!voice.loop) {
+                voice.active = false;
+                return;
+            }
+            voice.position -= buffer.frames;
+        }
     }
-    return 0.0f;
 }
 
-void PhysicsWorld::applyForce(b2Body* body, const Vector2& force) {
-    if (body) {
-        body->ApplyForceToCenter(b2Vec2(force.x, force.y), true);
+void AudioManager::mixerThreadMain() {
+    std::vector<float> block(static_cast<size_t>(kBlockFrames) * 2);
+    auto blockDuration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(static_cast<double>(kBlockFrames) / m_sampleRate));
+    auto deadline = std::chrono::steady_clock::now();
+    
+    while (m_mixerRunning.load(std::memory_order_acquire)) {
+        mix(block.data(), kBlockFrames);
+        if (m_outputCallback) {
+            m_outputCallback(block.data(), kBlockFrames);
+        }
+        
+        // Render at real-time pace
+        deadline += blockDuration;
+        std::this_thread::sleep_until(deadline);
     }
 }
 
-void PhysicsWorld::applyImpulse(b2Body* body, const Vector2& impulse) {
-    if (body) {
-        body->ApplyLinearImpulseToCenter(b2Vec2(impulse.x, impulse.y), true);
+bool AudioManager::decodeWav(const std::string& filePath, SoundBuffer& buffer) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file) {
+        return false;
     }
-}
\ No newline at end of file
+    
+    std::vector<unsigned char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (data.size() < 12 || std::memcmp(data.data(), "RIFF", 4) != 0 || std::memcmp(data.data() + 8, "WAVE", 4) != 0) {
+        return false;
+    }
+    
+    int format = 0;
+    int channels = 0;
+    int sampleRate = 0;
+    int bitsPerSample = 0;
+    const unsigned char* pcm = nullptr;
+    size_t pcmBytes = 0;
+    
+    // Walk the RIFF chunks looking for "fmt " and "data"
+    size_t offset = 12;
+    while (offset + 8 <= data.size()) {
+        const unsigned char* chunk = data.data() + offset;
+        size_t chunkSize = readU32(chunk + 4);
+        size_t available = std::min(chunkSize, data.size() - offset - 8);
+        
+        if (std::memcmp(chunk, "fmt ", 4) == 0 && available >= 16) {
+            format = readU16(chunk + 8);
+            channels = readU16(chunk + 10);
+            sampleRate = static_cast<int>(readU32(chunk + 12));
+            bitsPerSample = readU16(chunk + 22);
+        } else if (std::memcmp(chunk, "data", 4) == 0) {
+            pcm = chunk + 8;
+            pcmBytes = available;
+        }
+        
+        // A chunk running past the end is the last one; stepping over it could wrap offset
+        if (chunkSize > data.size() - offset - 8) {
+            break;
+        }
+        offset += 8 + chunkSize + (chunkSize & 1);
+    }
+    
+    // 16-bit integer PCM or 32-bit float, mono or stereo
+    bool isPcm16 = format == 1 && bitsPerSample == 16;
+    bool isFloat = format == 3 && bitsPerSample == 32;
+    if (!pcm || (!isPcm16 && !isFloat) || channels < 1 || channels > 2 || sampleRate <= 0) {
+        return false;
+    }
+    
+    size_t sampleCount = pcmBytes / (bitsPerSample / 8);
+    sampleCount -= sampleCount % channels;
+    if (sampleCount == 0) {
+        return false;
+    }
+    
+    buffer.samples.resize(sampleCount);
+    for (size_t i = 0; i < sampleCount; ++i) {
+        if (isPcm16) {
+            int16_t value = static_cast<int16_t>(readU16(pcm + i * 2));
+            buffer.samples[i] = value / 32768.0f;
+        } else {
+            std::memcpy(&buffer.samples[i], pcm + i * 4, sizeof(float));
+        }
+    }
+    buffer.frames = static_cast<int>(sampleCount / channels);
+    buffer.channels = channels;
+    buffer.sampleRate = sampleRate;
+    return true;
+}
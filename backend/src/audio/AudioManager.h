@@ -5,10 +5,31 @@
 #include <unordered_map>
 #include <memory>
 #include <vector>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <cstdint>
+#include "../concurrency/SpscQueue.h"
+#include "../engine/GameEvents.h"
 
-// Simple audio manager for web and WebAssembly
+// Integer handle for a loaded sound, resolved from its name at load time
+using SoundId = int;
+constexpr SoundId kInvalidSoundId = -1;
+
+// Software audio mixer for native and WebAssembly builds.
+// The game thread only pushes commands into a lock-free queue; a mixer
+// thread (native) or the AudioWorklet pulling mix() (WebAssembly) owns
+// the voices and renders preloaded PCM buffers into stereo float output.
 class AudioManager {
 public:
+    // Fixed limits; nothing is allocated while mixing
+    static constexpr int kMaxSounds = 64;
+    static constexpr int kMaxVoices = 32;
+    static constexpr int kBlockFrames = 512;
+    
+    // Receives each block of interleaved stereo samples from the mixer thread
+    using OutputCallback = std::function<void(const float* samples, int frames)>;
+    
     AudioManager();
     ~AudioManager();
     
@@ -18,15 +39,38 @@ public:
     // Main update function
     void update(float deltaTime);
     
-    // Sound controls
+    // Sound controls; the SoundId overloads do no string hashing
+    void playSound(SoundId sound, float volume = 1.0f);
+    void stopSound(SoundId sound);
     void playSound(const std::string& name);
     void stopSound(const std::string& name);
     void stopAllSounds();
     
     // Background music
+    void playMusic(SoundId sound, bool loop = true);
     void playMusic(const std::string& name, bool loop = true);
     void stopMusic();
     
+    // Name -> handle lookup; do this once after loading, not per play
+    SoundId getSoundId(const std::string& name) const;
+    
+    // Per-sound voice policy. When the pool is full, a new sound steals the
+    // oldest voice of the lowest priority not above its own. A sound never
+    // holds more than maxVoices voices; extra plays restart its oldest one,
+    // and extra requests within one frame are coalesced before queueing.
+    void setSoundPriority(SoundId sound, int priority);
+    void setSoundMaxVoices(SoundId sound, int maxVoices);
+    
+    // Voices sounds may use, up to kMaxVoices; lowering it stops the voices above the limit
+    void setVoiceLimit(int voices);
+    int getVoiceLimit() const { return m_voiceLimit; }
+    
+    // Gameplay events: bind a sound to an event type, then hand the bus to
+    // drainEvents() once per frame. Events are read in batches with this
+    // manager's own cursor; no callback runs per event.
+    void setEventSound(GameEventType type, SoundId sound, float volume = 1.0f);
+    void drainEvents(const GameEventBus& events);
+    
     // Volume controls
     void setSoundVolume(float volume);
     void setMusicVolume(float volume);
@@ -39,36 +83,133 @@ public:
     bool areSoundsMuted() const { return m_soundsMuted; }
     bool isMusicMuted() const { return m_musicMuted; }
     
-    // Resource management
+    // Resource management; call before gameplay, buffers are immutable once
+    // loaded. Loading a name again keeps its first buffer and returns true.
     bool loadSound(const std::string& name, const std::string& filePath);
     bool loadMusic(const std::string& name, const std::string& filePath);
+    bool loadSoundFromMemory(const std::string& name, const float* samples, int frames, int channels, int sampleRate);
     
+    // Output configuration; set before initialize()
+    void setSampleRate(int sampleRate) { m_sampleRate = sampleRate; }
+    int getSampleRate() const { return m_sampleRate; }
+    void setOutputCallback(OutputCallback callback) { m_outputCallback = std::move(callback); }
+    
+    // Native hosts with their own audio callback can disable the mixer
+    // thread and call mix() from that callback instead
+    void setUseMixerThread(bool useThread) { m_useMixerThread = useThread; }
+    
+    // Render interleaved stereo frames. Called by the mixer thread, or by
+    // the AudioWorklet/audio callback when no mixer thread is running;
+    // there must only ever be one caller.
+    void mix(float* output, int frames);
+    
+    // Statistics
+    int getActiveVoiceCount() const { return m_activeVoices.load(std::memory_order_relaxed); }
+    unsigned int getDroppedCommands() const { return m_droppedCommands; }
+    unsigned int getCoalescedPlays() const { return m_coalescedPlays; }
+    unsigned int getStolenVoices() const { return m_stolenVoices.load(std::memory_order_relaxed); }
+    unsigned int getRejectedPlays() const { return m_rejectedPlays.load(std::memory_order_relaxed); }
+    uint64_t getDroppedEvents() const { return m_droppedEvents; }
+
 private:
+    // Decoded PCM, stored as float samples
+    struct SoundBuffer {
+        std::vector<float> samples;
+        int frames = 0;
+        int channels = 1;
+        int sampleRate = 48000;
+    };
+    
     // Sound resource
     struct SoundResource {
         std::string filePath;
-        // In a real implementation, this would contain audio buffer data
-        // or references to Web Audio API nodes
+        int bufferIndex;
         bool loaded;
     };
     
-    // Active sound instance
-    struct SoundInstance {
-        std::string name;
-        float volume;
+    // A playing buffer; owned by the mixer side
+    struct Voice {
+        int bufferIndex = -1;
+        double position = 0.0;
+        double step = 1.0;
+        float volume = 1.0f;
+        int priority = 0;
+        uint32_t startOrder = 0;
+        bool loop = false;
+        bool active = false;
+    };
+    
+    // Voice policy for one sound
+    struct SoundPolicy {
+        int priority = 0;
+        int maxVoices = 4;
+    };
+    
+    enum class CommandType {
+        PLAY_SOUND,
+        STOP_SOUND,
+        STOP_ALL_SOUNDS,
+        PLAY_MUSIC,
+        STOP_MUSIC,
+        SET_SOUND_GAIN,
+        SET_MUSIC_GAIN,
+        SET_SOUND_POLICY,
+        SET_VOICE_LIMIT
+    };
+    
+    struct Command {
+        CommandType type;
+        int bufferIndex;
+        float value;
         bool loop;
-        float playbackPosition;
-        bool isPlaying;
+        SoundPolicy policy;
+        int voiceLimit = 0;     // SET_VOICE_LIMIT only
     };
     
     // Sound resources
     std::unordered_map<std::string, SoundResource> m_soundResources;
     
-    // Active sound instances
-    std::vector<SoundInstance> m_activeSounds;
+    // Buffers are published to the mixer by bumping m_bufferCount
+    SoundBuffer m_buffers[kMaxSounds];
+    std::atomic<int> m_bufferCount;
+    
+    // Game thread -> mixer commands
+    SpscQueue<Command, 1024> m_commands;
+    unsigned int m_droppedCommands;
     
-    // Currently playing music
-    SoundInstance m_currentMusic;
+    // Game-thread view of the voice policies and this frame's play requests
+    SoundPolicy m_policies[kMaxSounds];
+    int m_requestsThisFrame[kMaxSounds];
+    unsigned int m_coalescedPlays;
+    int m_voiceLimit;
+    
+    // Event type -> sound bindings and the read position in the event bus
+    struct EventSound {
+        SoundId sound = kInvalidSoundId;
+        float volume = 1.0f;
+    };
+    EventSound m_eventSounds[static_cast<int>(GameEventType::COUNT)];
+    uint64_t m_eventCursor;
+    uint64_t m_droppedEvents;
+    
+    // Mixer-side state
+    Voice m_voices[kMaxVoices];
+    Voice m_musicVoice;
+    SoundPolicy m_mixerPolicies[kMaxSounds];
+    int m_mixerVoiceLimit;
+    uint32_t m_nextStartOrder;
+    std::atomic<unsigned int> m_stolenVoices;
+    std::atomic<unsigned int> m_rejectedPlays;
+    float m_soundGain;
+    float m_musicGain;
+    std::atomic<int> m_activeVoices;
+    
+    // Mixer thread (native builds)
+    std::thread m_mixerThread;
+    std::atomic<bool> m_mixerRunning;
+    bool m_useMixerThread;
+    OutputCallback m_outputCallback;
+    int m_sampleRate;
     
     // Volume settings
     float m_soundVolume;
@@ -80,4 +221,15 @@ private:
     
     // Initialization state
     bool m_initialized;
-};
\ No newline at end of file
+    
+    void sendCommand(const Command& command);
+    void applyCommand(const Command& command);
+    void startVoice(Voice& voice, int bufferIndex, float volume, bool loop);
+    void startSoundVoice(int bufferIndex, float volume);
+    void mixVoice(Voice& voice, float gain, float* output, int frames);
+    int addBuffer(SoundBuffer&& buffer);
+    void updateGains();
+    void mixerThreadMain();
+    
+    static bool decodeWav(const std::string& filePath, SoundBuffer& buffer);
+};
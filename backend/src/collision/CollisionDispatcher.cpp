@@ -0,0 +1,158 @@
+// backend/src/collision/CollisionDispatcher.cpp
+#include "CollisionDispatcher.h"
+#include "../Player.h"
+#include "../Drone.h"
+#include "../include/Projectile.h"
+#include "../include/PowerUp.h"
+#include <algorithm>
+
+namespace {
+const float kDroneContactDamage = 10.0f;
+
+int typeIndex(const Entity* entity) {
+    return static_cast<int>(entity->getType());
+}
+
+bool bothActive(const Contact& contact) {
+    return contact.a->isActive() && contact.b->isActive();
+}
+
+// Drones damage the player once per contact, not per frame of overlap
+size_t resolvePlayerDrone(const Contact* contacts, size_t count, GameEventBus& events) {
+    size_t applied = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (contacts[i].phase != ContactPhase::BEGIN || !bothActive(contacts[i])) {
+            continue;
+        }
+        Entity* player = contacts[i].a;
+        static_cast<Player*>(player)->takeDamage(kDroneContactDamage);
+        events.emit(GameEventType::PLAYER_DAMAGED, player->getId(), contacts[i].b->getId(),
+                    player->getPosition().x, player->getPosition().y, kDroneContactDamage);
+        applied++;
+    }
+    return applied;
+}
+
+// Enemy projectile entities are consumed by the player
+size_t resolvePlayerProjectile(const Contact* contacts, size_t count, GameEventBus&) {
+    size_t applied = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (!bothActive(contacts[i])) {
+            continue;
+        }
+        Projectile* projectile = static_cast<Projectile*>(contacts[i].b);
+        if (projectile->getProjectileType() == ProjectileType::ENEMY) {
+            projectile->setActive(false);
+        }
+        applied++;
+    }
+    return applied;
+}
+
+// The player collects power-ups
+size_t resolvePlayerPowerUp(const Contact* contacts, size_t count, GameEventBus& events) {
+    size_t applied = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (!bothActive(contacts[i])) {
+            continue;
+        }
+        PowerUp* powerUp = static_cast<PowerUp*>(contacts[i].b);
+        powerUp->setActive(false);
+        events.emit(GameEventType::POWERUP_COLLECTED, powerUp->getId(), contacts[i].a->getId(),
+                    powerUp->getPosition().x, powerUp->getPosition().y,
+                    static_cast<float>(powerUp->getPowerUpType()));
+        applied++;
+    }
+    return applied;
+}
+
+// Drones are destroyed by projectiles; player projectiles are spent on them
+size_t resolveDroneProjectile(const Contact* contacts, size_t count, GameEventBus& events) {
+    size_t applied = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (!bothActive(contacts[i])) {
+            continue;
+        }
+        Projectile* projectile = static_cast<Projectile*>(contacts[i].b);
+        Entity* drone = contacts[i].a;
+        drone->setActive(false);
+        events.emit(GameEventType::DRONE_DESTROYED, drone->getId(), projectile->getSourceId(),
+                    drone->getPosition().x, drone->getPosition().y);
+        if (projectile->getProjectileType() == ProjectileType::PLAYER) {
+            projectile->setActive(false);
+        }
+        applied++;
+    }
+    return applied;
+}
+}
+
+CollisionDispatcher::CollisionDispatcher() {
+    for (auto& row : m_table) {
+        for (auto& response : row) {
+            response = nullptr;
+        }
+    }
+    
+    registerResponse(EntityType::PLAYER, EntityType::DRONE, resolvePlayerDrone);
+    registerResponse(EntityType::PLAYER, EntityType::PROJECTILE, resolvePlayerProjectile);
+    registerResponse(EntityType::PLAYER, EntityType::POWERUP, resolvePlayerPowerUp);
+    registerResponse(EntityType::DRONE, EntityType::PROJECTILE, resolveDroneProjectile);
+}
+
+void CollisionDispatcher::registerResponse(EntityType a, EntityType b, CollisionResponseFn response) {
+    int first = std::min(static_cast<int>(a), static_cast<int>(b));
+    int second = std::max(static_cast<int>(a), static_cast<int>(b));
+    m_table[first][second] = response;
+}
+
+size_t CollisionDispatcher::dispatch(const ArenaVector<Contact>& contacts, FrameArena& arena, GameEventBus& events) const {
+    if (contacts.empty()) {
+        return 0;
+    }
+    
+    // Counting sort into type-pair buckets; the bucket order is fixed, so
+    // resolution order is deterministic
+    constexpr int kBuckets = kTypeCount * kTypeCount;
+    size_t bucketStart[kBuckets + 1] = {};
+    for (const Contact& contact : contacts) {
+        bucketStart[typeIndex(contact.a) * kTypeCount + typeIndex(contact.b) + 1]++;
+    }
+    for (int bucket = 0; bucket < kBuckets; ++bucket) {
+        bucketStart[bucket + 1] += bucketStart[bucket];
+    }
+    
+    Contact* sorted = static_cast<Contact*>(arena.allocate(contacts.size() * sizeof(Contact), alignof(Contact)));
+    size_t cursor[kBuckets];
+    std::copy(bucketStart, bucketStart + kBuckets, cursor);
+    for (const Contact& contact : contacts) {
+        sorted[cursor[typeIndex(contact.a) * kTypeCount + typeIndex(contact.b)]++] = contact;
+    }
+    
+    size_t applied = 0;
+    for (int bucket = 0; bucket < kBuckets; ++bucket) {
+        size_t count = bucketStart[bucket + 1] - bucketStart[bucket];
+        if (count == 0) {
+            continue;
+        }
+        
+        CollisionResponseFn response = m_table[bucket / kTypeCount][bucket % kTypeCount];
+        const Contact* run = sorted + bucketStart[bucket];
+        applied += response ? response(run, count, events) : dispatchVirtual(run, count, events);
+    }
+    return applied;
+}
+
+// handleCollision runs once per contact, when it begins
+size_t CollisionDispatcher::dispatchVirtual(const Contact* contacts, size_t count, GameEventBus&) {
+    size_t applied = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (contacts[i].phase != ContactPhase::BEGIN || !bothActive(contacts[i])) {
+            continue;
+        }
+        contacts[i].a->handleCollision(contacts[i].b);
+        contacts[i].b->handleCollision(contacts[i].a);
+        applied++;
+    }
+    return applied;
+}
@@ -0,0 +1,52 @@
+// backend/src/collision/CollisionDispatcher.h
+#pragma once
+
+#include <cstddef>
+#include "../Entity.h"
+#include "../memory/FrameArena.h"
+#include "../engine/GameEvents.h"
+#include "PairCache.h"
+
+// Two overlapping entities, ordered so a->getType() <= b->getType().
+// phase is BEGIN on the first frame of a touch and STAY after that.
+struct Contact {
+    Entity* a;
+    Entity* b;
+    ContactPhase phase;
+    
+    Contact(Entity* first, Entity* second, ContactPhase contactPhase = ContactPhase::BEGIN)
+        : phase(contactPhase) {
+        bool swap = static_cast<int>(second->getType()) < static_cast<int>(first->getType());
+        a = swap ? second : first;
+        b = swap ? first : second;
+    }
+};
+
+// Resolves a run of contacts that all share one type pair and reports
+// their side effects to events. Returns how many contacts were applied.
+using CollisionResponseFn = size_t (*)(const Contact* contacts, size_t count, GameEventBus& events);
+
+// Type-pair dispatch table for collision response. Contacts are bucketed
+// by (type, type) and each bucket is resolved in one tight loop, e.g. every
+// projectile-drone hit in a single pass, instead of two virtual
+// handleCollision calls per pair. Pairs without a registered response
+// fall back to handleCollision.
+class CollisionDispatcher {
+public:
+    static constexpr int kTypeCount = 4;
+    
+    // Registers the built-in gameplay responses
+    CollisionDispatcher();
+    
+    // Order of the two types does not matter; null restores the fallback
+    void registerResponse(EntityType a, EntityType b, CollisionResponseFn response);
+    
+    // Sort contacts by type pair and resolve them bucket by bucket.
+    // Returns the number of contacts applied.
+    size_t dispatch(const ArenaVector<Contact>& contacts, FrameArena& arena, GameEventBus& events) const;
+
+private:
+    CollisionResponseFn m_table[kTypeCount][kTypeCount];
+    
+    static size_t dispatchVirtual(const Contact* contacts, size_t count, GameEventBus& events);
+};
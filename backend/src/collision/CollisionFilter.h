@@ -0,0 +1,34 @@
+// backend/src/collision/CollisionFilter.h
+#pragma once
+
+#include <cstdint>
+
+// Category bits, one per kind of collidable
+namespace CollisionCategory {
+constexpr uint16_t PLAYER = 1 << 0;
+constexpr uint16_t DRONE = 1 << 1;
+constexpr uint16_t PROJECTILE = 1 << 2;
+constexpr uint16_t POWERUP = 1 << 3;
+constexpr uint16_t ALL = 0xFFFF;
+}
+
+// Decides in the broadphase whether two collidables may interact at all.
+// A pair is kept only if each side's category is in the other's mask and
+// neither side names the other as its ignored id (e.g. a projectile's shooter).
+struct CollisionFilter {
+    uint16_t category = CollisionCategory::ALL;
+    uint16_t mask = CollisionCategory::ALL;
+    int ignoreId = -1;
+    
+    CollisionFilter() = default;
+    CollisionFilter(uint16_t categoryBits, uint16_t maskBits, int ignoredId = -1)
+        : category(categoryBits), mask(maskBits), ignoreId(ignoredId) {
+    }
+};
+
+inline bool shouldCollide(const CollisionFilter& a, int idA, const CollisionFilter& b, int idB) {
+    if ((a.category & b.mask) == 0 || (b.category & a.mask) == 0) {
+        return false;
+    }
+    return (a.ignoreId < 0 || a.ignoreId != idB) && (b.ignoreId < 0 || b.ignoreId != idA);
+}
@@ -0,0 +1,235 @@
+// backend/src/collision/HierarchicalGrid.cpp
+#include "HierarchicalGrid.h"
+#include <algorithm>
+#include <cmath>
+
+HierarchicalGrid::HierarchicalGrid(float baseCellSize)
+    : m_baseCellSize(baseCellSize),
+      m_fatMargin(0.0f),
+      m_min(0.0f, 0.0f),
+      m_max(800.0f, 600.0f),
+      m_levelCount(1),
+      m_relinks(0) {
+    updateLevels();
+}
+
+void HierarchicalGrid::setBounds(const Vector2& min, const Vector2& max) {
+    if (min.x == m_min.x && min.y == m_min.y && max.x == m_max.x && max.y == m_max.y) {
+        return;
+    }
+    m_min = min;
+    m_max = max;
+    updateLevels();
+}
+
+void HierarchicalGrid::setBaseCellSize(float cellSize) {
+    m_baseCellSize = cellSize;
+    updateLevels();
+}
+
+void HierarchicalGrid::updateLevels() {
+    // Double the cell size until one cell spans the whole world
+    float extent = std::max(m_max.x - m_min.x, m_max.y - m_min.y);
+    float cellSize = m_baseCellSize;
+    m_levelCount = 1;
+    while (m_levelCount < kMaxLevels && cellSize < extent) {
+        cellSize *= 2.0f;
+        m_levelCount++;
+    }
+    
+    cellSize = m_baseCellSize;
+    for (int l = 0; l < kMaxLevels; ++l) {
+        Level& level = m_levels[l];
+        level.cellSize = cellSize;
+        level.inverseCellSize = 1.0f / cellSize;
+        level.count = 0;
+        level.maxRadius = 0.0f;
+        if (l < m_levelCount) {
+            level.columns = std::max(1, static_cast<int>(std::ceil((m_max.x - m_min.x) * level.inverseCellSize)));
+            level.rows = std::max(1, static_cast<int>(std::ceil((m_max.y - m_min.y) * level.inverseCellSize)));
+            level.heads.assign(static_cast<size_t>(level.columns) * level.rows, -1);
+        } else {
+            level.columns = 1;
+            level.rows = 1;
+            level.heads.clear();
+        }
+        cellSize *= 2.0f;
+    }
+    
+    // The cells changed under every live item
+    for (int handle : m_live) {
+        Item& item = m_items[handle];
+        item.level = levelFor(item.fatRadius);
+        item.cell = cellFor(m_levels[item.level], item.fatX, item.fatY);
+        link(handle);
+    }
+}
+
+int HierarchicalGrid::levelFor(float radius) const {
+    int level = 0;
+    float diameter = radius * 2.0f;
+    while (level < m_levelCount - 1 && m_levels[level].cellSize < diameter) {
+        level++;
+    }
+    return level;
+}
+
+int HierarchicalGrid::cellFor(const Level& level, float x, float y) const {
+    int cellX = clampCell(x - m_min.x, level.inverseCellSize, level.columns);
+    int cellY = clampCell(y - m_min.y, level.inverseCellSize, level.rows);
+    return cellY * level.columns + cellX;
+}
+
+void HierarchicalGrid::link(int handle) {
+    Item& item = m_items[handle];
+    Level& level = m_levels[item.level];
+    int& head = level.heads[item.cell];
+    
+    item.prev = -1;
+    item.next = head;
+    if (head >= 0) {
+        m_items[head].prev = handle;
+    }
+    head = handle;
+    
+    level.count++;
+    level.maxRadius = std::max(level.maxRadius, item.fatRadius);
+}
+
+void HierarchicalGrid::unlink(int handle) {
+    Item& item = m_items[handle];
+    Level& level = m_levels[item.level];
+    
+    if (item.prev >= 0) {
+        m_items[item.prev].next = item.next;
+    } else {
+        level.heads[item.cell] = item.next;
+    }
+    if (item.next >= 0) {
+        m_items[item.next].prev = item.prev;
+    }
+    level.count--;
+}
+
+int HierarchicalGrid::add(int userIndex, const Vector2& position, float radius,
+                          const CollisionFilter& filter, int id) {
+    int handle;
+    if (!m_freeHandles.empty()) {
+        handle = m_freeHandles.back();
+        m_freeHandles.pop_back();
+    } else {
+        handle = static_cast<int>(m_items.size());
+        m_items.emplace_back();
+    }
+    
+    Item& item = m_items[handle];
+    item.x = position.x;
+    item.y = position.y;
+    item.radius = radius;
+    item.fatX = position.x;
+    item.fatY = position.y;
+    item.fatRadius = radius + m_fatMargin;
+    item.userIndex = userIndex;
+    item.filter = filter;
+    item.id = id;
+    item.level = levelFor(item.fatRadius);
+    item.cell = cellFor(m_levels[item.level], item.fatX, item.fatY);
+    item.liveIndex = static_cast<int>(m_live.size());
+    m_live.push_back(handle);
+    
+    link(handle);
+    markMoved(handle);
+    return handle;
+}
+
+void HierarchicalGrid::update(int handle, int userIndex, const Vector2& position, float radius,
+                              const CollisionFilter& filter, int id) {
+    Item& item = m_items[handle];
+    bool changed = item.x != position.x || item.y != position.y || item.radius != radius || item.id != id ||
+                   item.filter.category != filter.category || item.filter.mask != filter.mask ||
+                   item.filter.ignoreId != filter.ignoreId;
+    item.x = position.x;
+    item.y = position.y;
+    item.radius = radius;
+    item.userIndex = userIndex;
+    item.filter = filter;
+    item.id = id;
+    
+    // Still inside the fat circle: nothing to rebin
+    float slack = item.fatRadius - radius;
+    float dx = position.x - item.fatX;
+    float dy = position.y - item.fatY;
+    if (slack < 0.0f || dx * dx + dy * dy > slack * slack) {
+        refit(handle);
+    }
+    if (changed) {
+        markMoved(handle);
+    }
+}
+
+void HierarchicalGrid::refit(int handle) {
+    Item& item = m_items[handle];
+    item.fatX = item.x;
+    item.fatY = item.y;
+    item.fatRadius = item.radius + m_fatMargin;
+    
+    int level = levelFor(item.fatRadius);
+    int cell = cellFor(m_levels[level], item.fatX, item.fatY);
+    if (level == item.level && cell == item.cell) {
+        m_levels[level].maxRadius = std::max(m_levels[level].maxRadius, item.fatRadius);
+        return;
+    }
+    
+    // Moved to another cell or level
+    unlink(handle);
+    item.level = level;
+    item.cell = cell;
+    link(handle);
+    m_relinks++;
+}
+
+void HierarchicalGrid::markMoved(int handle) {
+    Item& item = m_items[handle];
+    if (!item.moved) {
+        item.moved = true;
+        m_moved.push_back(handle);
+    }
+}
+
+void HierarchicalGrid::clearChanges() {
+    for (int handle : m_moved) {
+        m_items[handle].moved = false;
+    }
+    m_moved.clear();
+    m_removed.clear();
+}
+
+void HierarchicalGrid::remove(int handle) {
+    unlink(handle);
+    
+    // Swap-remove from the live list
+    int liveIndex = m_items[handle].liveIndex;
+    int last = m_live.back();
+    m_live[liveIndex] = last;
+    m_items[last].liveIndex = liveIndex;
+    m_live.pop_back();
+    
+    m_items[handle].liveIndex = -1;
+    m_freeHandles.push_back(handle);
+    m_removed.push_back(handle);
+}
+
+void HierarchicalGrid::clear() {
+    for (int l = 0; l < m_levelCount; ++l) {
+        Level& level = m_levels[l];
+        std::fill(level.heads.begin(), level.heads.end(), -1);
+        level.count = 0;
+        level.maxRadius = 0.0f;
+    }
+    m_items.clear();
+    m_freeHandles.clear();
+    m_live.clear();
+    m_relinks = 0;
+    m_moved.clear();
+    m_removed.clear();
+}
@@ -0,0 +1,326 @@
+// backend/src/collision/HierarchicalGrid.h
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include "../vector2.h"
+#include "CollisionFilter.h"
+#include "SpatialGrid.h"
+
+// Multi-level grid broadphase for items of very different sizes.
+// Level L has cells of baseCellSize * 2^L; each item lives in the finest
+// level whose cells are at least its diameter, so a query only has to look
+// one ring of cells around itself on every level. The top level covers the
+// world and takes anything larger.
+//
+// Items are persistent: add() returns a handle, and update() only relinks
+// the item when it moves to another cell or level. Cells are intrusive
+// doubly linked lists, so relinking is O(1) and allocates nothing.
+//
+// Each item is binned by a fat circle, its circle grown by the fat margin,
+// and is only rebinned once its circle leaves that bound. Separately, the
+// handles whose circle or filter changed at all (or that were added or
+// removed) are collected for incremental pair tracking (see PairCache).
+class HierarchicalGrid {
+public:
+    static constexpr int kMaxLevels = 10;
+    
+    HierarchicalGrid(float baseCellSize = 16.0f);
+    
+    // Area covered by the grid; items outside are clamped to the border cells.
+    // Changing either relinks every item.
+    void setBounds(const Vector2& min, const Vector2& max);
+    void setBaseCellSize(float cellSize);
+    
+    // Slack around each item before it is rebinned; applies as items refit
+    void setFatMargin(float margin) { m_fatMargin = margin; }
+    float getFatMargin() const { return m_fatMargin; }
+    
+    // Returns a handle that stays valid until remove() or clear()
+    int add(int userIndex, const Vector2& position, float radius,
+            const CollisionFilter& filter = CollisionFilter(), int id = -1);
+    void update(int handle, int userIndex, const Vector2& position, float radius,
+                const CollisionFilter& filter = CollisionFilter(), int id = -1);
+    void remove(int handle);
+    void clear();
+    
+    // Calls fn(userIndex) for every item that passes the filter and whose
+    // circle overlaps the query circle
+    template<typename Fn>
+    BroadphaseCounts queryCircle(const Vector2& center, float radius, const CollisionFilter& filter, int id, Fn&& fn) const;
+    
+    // Calls fn(userIndexA, userIndexB) once for every pair of overlapping
+    // circles that passes the filters
+    template<typename Fn>
+    BroadphaseCounts forEachOverlappingPair(Fn&& fn) const;
+    
+    // The same traversal, calling fn(handleA, handleB)
+    template<typename Fn>
+    BroadphaseCounts forEachOverlappingHandlePair(Fn&& fn) const;
+    
+    int getItemCount() const { return static_cast<int>(m_live.size()); }
+    int getLevelCount() const { return m_levelCount; }
+    int getItemCountAtLevel(int level) const { return m_levels[level].count; }
+    
+    // Cell or level changes made by update() since the last reset
+    unsigned int getRelinks() const { return m_relinks; }
+    void resetRelinks() { m_relinks = 0; }
+    
+    // Changes since the last clearChanges(): handles that were added or whose
+    // circle, filter or id changed, and handles that were removed. A handle
+    // can be in both lists when it was freed and reused.
+    const std::vector<int>& getMovedHandles() const { return m_moved; }
+    const std::vector<int>& getRemovedHandles() const { return m_removed; }
+    void clearChanges();
+    
+    // Per-handle access for pair tracking
+    int getHandleCapacity() const { return static_cast<int>(m_items.size()); }
+    bool isLive(int handle) const { return m_items[handle].liveIndex >= 0; }
+    int getUserIndex(int handle) const { return m_items[handle].userIndex; }
+    int getId(int handle) const { return m_items[handle].id; }
+    
+    // Level and cell the item is binned in, as one key; handles sorted by it
+    // are queried in memory-friendly order
+    uint32_t getBinKey(int handle) const {
+        return (static_cast<uint32_t>(m_items[handle].level) << 24) | static_cast<uint32_t>(m_items[handle].cell);
+    }
+    
+    // Calls fn(otherHandle) for every item whose circle overlaps this
+    // item's circle and that passes the filters
+    template<typename Fn>
+    BroadphaseCounts forEachOverlap(int handle, Fn&& fn) const;
+
+private:
+    struct Item {
+        float x;
+        float y;
+        float radius;
+        float fatX;
+        float fatY;
+        float fatRadius;
+        int userIndex;
+        CollisionFilter filter;
+        int id;
+        int level;
+        int cell;
+        int prev;
+        int next;
+        int liveIndex;
+        bool moved;
+    };
+    
+    struct Level {
+        float cellSize = 0.0f;
+        float inverseCellSize = 0.0f;
+        int columns = 1;
+        int rows = 1;
+        int count = 0;
+        float maxRadius = 0.0f;     // Largest fat radius; grows only, reset by clear()
+        std::vector<int> heads;     // First item handle per cell, -1 if empty
+    };
+    
+    float m_baseCellSize;
+    float m_fatMargin;
+    Vector2 m_min;
+    Vector2 m_max;
+    Level m_levels[kMaxLevels];
+    int m_levelCount;
+    
+    std::vector<Item> m_items;      // Indexed by handle
+    std::vector<int> m_freeHandles;
+    std::vector<int> m_live;        // Handles of live items, unordered
+    unsigned int m_relinks;
+    std::vector<int> m_moved;
+    std::vector<int> m_removed;
+    
+    void updateLevels();
+    int levelFor(float radius) const;
+    int cellFor(const Level& level, float x, float y) const;
+    void link(int handle);
+    void unlink(int handle);
+    void refit(int handle);
+    void markMoved(int handle);
+    
+    static int clampCell(float offset, float inverseCellSize, int cells);
+};
+
+inline int HierarchicalGrid::clampCell(float offset, float inverseCellSize, int cells) {
+    int cell = static_cast<int>(offset * inverseCellSize);
+    return cell < 0 ? 0 : (cell >= cells ? cells - 1 : cell);
+}
+
+template<typename Fn>
+BroadphaseCounts HierarchicalGrid::queryCircle(const Vector2& center, float radius, const CollisionFilter& filter, int id, Fn&& fn) const {
+    BroadphaseCounts counts;
+    
+    for (int l = 0; l < m_levelCount; ++l) {
+        const Level& level = m_levels[l];
+        if (level.count == 0) {
+            continue;
+        }
+        
+        // Items are binned by fat circle, which contains the real one
+        float reach = radius + level.maxRadius;
+        int x0 = clampCell(center.x - reach - m_min.x, level.inverseCellSize, level.columns);
+        int x1 = clampCell(center.x + reach - m_min.x, level.inverseCellSize, level.columns);
+        int y0 = clampCell(center.y - reach - m_min.y, level.inverseCellSize, level.rows);
+        int y1 = clampCell(center.y + reach - m_min.y, level.inverseCellSize, level.rows);
+        
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                for (int h = level.heads[y * level.columns + x]; h >= 0; h = m_items[h].next) {
+                    const Item& item = m_items[h];
+                    if (!shouldCollide(filter, id, item.filter, item.id)) {
+                        counts.filteredPairs++;
+                        continue;
+                    }
+                    
+                    counts.distanceTests++;
+                    float dx = item.x - center.x;
+                    float dy = item.y - center.y;
+                    float minDistance = item.radius + radius;
+                    if (dx * dx + dy * dy < minDistance * minDistance) {
+                        fn(item.userIndex);
+                    }
+                }
+            }
+        }
+    }
+    return counts;
+}
+
+template<typename Fn>
+BroadphaseCounts HierarchicalGrid::forEachOverlappingPair(Fn&& fn) const {
+    return forEachOverlappingHandlePair([&](int a, int b) {
+        fn(m_items[a].userIndex, m_items[b].userIndex);
+    });
+}
+
+template<typename Fn>
+BroadphaseCounts HierarchicalGrid::forEachOverlappingHandlePair(Fn&& fn) const {
+    BroadphaseCounts counts;
+    
+    auto testPair = [&](int a, int b) {
+        const Item& itemA = m_items[a];
+        const Item& itemB = m_items[b];
+        if (!shouldCollide(itemA.filter, itemA.id, itemB.filter, itemB.id)) {
+            counts.filteredPairs++;
+            return;
+        }
+        
+        counts.distanceTests++;
+        float dx = itemB.x - itemA.x;
+        float dy = itemB.y - itemA.y;
+        float minDistance = itemA.radius + itemB.radius;
+        if (dx * dx + dy * dy < minDistance * minDistance) {
+            fn(a, b);
+        }
+    };
+    
+    // Walk each level cell by cell. Pairs on the same level are reported
+    // from the lower cell (or the earlier item within a cell); pairs across
+    // levels are reported from the finer item, which searches the coarser
+    // levels around itself.
+    for (int l = 0; l < m_levelCount; ++l) {
+        const Level& level = m_levels[l];
+        if (level.count == 0) {
+            continue;
+        }
+        
+        for (int cy = 0; cy < level.rows; ++cy) {
+            for (int cx = 0; cx < level.columns; ++cx) {
+                int cell = cy * level.columns + cx;
+                
+                for (int a = level.heads[cell]; a >= 0; a = m_items[a].next) {
+                    const Item& itemA = m_items[a];
+                    
+                    // Rest of this cell
+                    for (int b = itemA.next; b >= 0; b = m_items[b].next) {
+                        testPair(a, b);
+                    }
+                    
+                    // Later neighbouring cells on the same level; windows are
+                    // centred on the fat circles the items are binned by
+                    float reach = itemA.fatRadius + level.maxRadius;
+                    int x0 = clampCell(itemA.fatX - reach - m_min.x, level.inverseCellSize, level.columns);
+                    int x1 = clampCell(itemA.fatX + reach - m_min.x, level.inverseCellSize, level.columns);
+                    int y1 = clampCell(itemA.fatY + reach - m_min.y, level.inverseCellSize, level.rows);
+                    for (int y = cy; y <= y1; ++y) {
+                        for (int x = (y == cy ? cx + 1 : x0); x <= x1; ++x) {
+                            for (int b = level.heads[y * level.columns + x]; b >= 0; b = m_items[b].next) {
+                                testPair(a, b);
+                            }
+                        }
+                    }
+                    
+                    // Coarser levels
+                    for (int k = l + 1; k < m_levelCount; ++k) {
+                        const Level& coarse = m_levels[k];
+                        if (coarse.count == 0) {
+                            continue;
+                        }
+                        
+                        float coarseReach = itemA.fatRadius + coarse.maxRadius;
+                        int kx0 = clampCell(itemA.fatX - coarseReach - m_min.x, coarse.inverseCellSize, coarse.columns);
+                        int kx1 = clampCell(itemA.fatX + coarseReach - m_min.x, coarse.inverseCellSize, coarse.columns);
+                        int ky0 = clampCell(itemA.fatY - coarseReach - m_min.y, coarse.inverseCellSize, coarse.rows);
+                        int ky1 = clampCell(itemA.fatY + coarseReach - m_min.y, coarse.inverseCellSize, coarse.rows);
+                        for (int y = ky0; y <= ky1; ++y) {
+                            for (int x = kx0; x <= kx1; ++x) {
+                                for (int b = coarse.heads[y * coarse.columns + x]; b >= 0; b = m_items[b].next) {
+                                    testPair(a, b);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return counts;
+}
+
+template<typename Fn>
+BroadphaseCounts HierarchicalGrid::forEachOverlap(int handle, Fn&& fn) const {
+    BroadphaseCounts counts;
+    const Item& item = m_items[handle];
+    
+    for (int l = 0; l < m_levelCount; ++l) {
+        const Level& level = m_levels[l];
+        if (level.count == 0) {
+            continue;
+        }
+        
+        // Items are binned by fat circle, which contains the real one
+        float reach = item.radius + level.maxRadius;
+        int x0 = clampCell(item.x - reach - m_min.x, level.inverseCellSize, level.columns);
+        int x1 = clampCell(item.x + reach - m_min.x, level.inverseCellSize, level.columns);
+        int y0 = clampCell(item.y - reach - m_min.y, level.inverseCellSize, level.rows);
+        int y1 = clampCell(item.y + reach - m_min.y, level.inverseCellSize, level.rows);
+        
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                for (int h = level.heads[y * level.columns + x]; h >= 0; h = m_items[h].next) {
+                    if (h == handle) {
+                        continue;
+                    }
+                    
+                    const Item& other = m_items[h];
+                    if (!shouldCollide(item.filter, item.id, other.filter, other.id)) {
+                        counts.filteredPairs++;
+                        continue;
+                    }
+                    
+                    counts.distanceTests++;
+                    float dx = other.x - item.x;
+                    float dy = other.y - item.y;
+                    float minDistance = other.radius + item.radius;
+                    if (dx * dx + dy * dy < minDistance * minDistance) {
+                        fn(h);
+                    }
+                }
+            }
+        }
+    }
+    return counts;
+}
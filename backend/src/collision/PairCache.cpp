@@ -0,0 +1,181 @@
+// backend/src/collision/PairCache.cpp
+#include "PairCache.h"
+#include <algorithm>
+
+namespace {
+// LSD radix sort, a byte per pass; passes whose byte is the same in every
+// key are skipped, so small handles cost four passes rather than eight
+void radixSort(std::vector<uint64_t>& keys, std::vector<uint64_t>& scratch) {
+    size_t counts[8][256] = {};
+    for (uint64_t key : keys) {
+        for (int digit = 0; digit < 8; ++digit) {
+            counts[digit][(key >> (digit * 8)) & 0xFF]++;
+        }
+    }
+    
+    scratch.resize(keys.size());
+    for (int digit = 0; digit < 8; ++digit) {
+        size_t* count = counts[digit];
+        if (count[(keys.empty() ? 0 : keys[0] >> (digit * 8)) & 0xFF] == keys.size()) {
+            continue;
+        }
+        
+        size_t offset = 0;
+        for (int bucket = 0; bucket < 256; ++bucket) {
+            size_t bucketCount = count[bucket];
+            count[bucket] = offset;
+            offset += bucketCount;
+        }
+        for (uint64_t key : keys) {
+            scratch[count[(key >> (digit * 8)) & 0xFF]++] = key;
+        }
+        keys.swap(scratch);
+    }
+}
+}
+
+uint64_t PairCache::makeKey(int a, int b) {
+    uint32_t low = static_cast<uint32_t>(std::min(a, b));
+    uint32_t high = static_cast<uint32_t>(std::max(a, b));
+    return (static_cast<uint64_t>(low) << 32) | high;
+}
+
+bool PairCache::wasTouching(int idA, int idB) const {
+    return !m_restored.empty() &&
+           std::binary_search(m_restored.begin(), m_restored.end(), std::make_pair(std::min(idA, idB), std::max(idA, idB)));
+}
+
+void PairCache::addPair(const HierarchicalGrid& grid, uint64_t key) {
+    int a = static_cast<int>(key >> 32);
+    int b = static_cast<int>(key & 0xFFFFFFFFu);
+    Pair pair = {key, grid.getId(a), grid.getId(b)};
+    ContactPhase phase = wasTouching(pair.idA, pair.idB) ? ContactPhase::STAY : ContactPhase::BEGIN;
+    m_events.push_back({grid.getUserIndex(a), grid.getUserIndex(b), pair.idA, pair.idB, phase});
+    m_merged.push_back(pair);
+}
+
+void PairCache::update(HierarchicalGrid& grid) {
+    m_events.clear();
+    m_counts = BroadphaseCounts();
+    m_queried = 0;
+    
+    // Grows with the grid; only this frame's moved and removed handles are set
+    if (m_flags.size() < static_cast<size_t>(grid.getHandleCapacity())) {
+        m_flags.resize(static_cast<size_t>(grid.getHandleCapacity()), 0);
+    }
+    for (int handle : grid.getMovedHandles()) {
+        m_flags[handle] |= kMoved;
+    }
+    for (int handle : grid.getRemovedHandles()) {
+        m_flags[handle] |= kRemoved;
+    }
+    
+    // Everything the moved items touch now. With few moved, each is queried
+    // on its own, in bin order so neighbouring queries share cells; a pair of
+    // two moved items is found from both sides and kept from the lower
+    // handle. Past kFullTraversalShare one traversal of the grid is cheaper.
+    m_found.clear();
+    m_queryOrder.clear();
+    for (int handle : grid.getMovedHandles()) {
+        if (grid.isLive(handle)) {
+            m_queryOrder.push_back((static_cast<uint64_t>(grid.getBinKey(handle)) << 32) | static_cast<uint32_t>(handle));
+        }
+    }
+    if (m_queryOrder.size() > grid.getItemCount() * kFullTraversalShare) {
+        m_queried = static_cast<size_t>(grid.getItemCount());
+        m_counts += grid.forEachOverlappingHandlePair([&](int a, int b) {
+            if ((m_flags[a] | m_flags[b]) & kMoved) {
+                m_found.push_back(makeKey(a, b));
+            }
+        });
+    } else {
+        radixSort(m_queryOrder, m_sortScratch);
+        for (uint64_t entry : m_queryOrder) {
+            int handle = static_cast<int>(entry & 0xFFFFFFFFu);
+            m_queried++;
+            m_counts += grid.forEachOverlap(handle, [&](int other) {
+                if (handle < other || !(m_flags[other] & kMoved)) {
+                    m_found.push_back(makeKey(handle, other));
+                }
+            });
+        }
+    }
+    radixSort(m_found, m_sortScratch);
+    
+    // Merge the finds into the sorted set; events come out in key order
+    m_merged.clear();
+    size_t found = 0;
+    for (const Pair& pair : m_pairs) {
+        while (found < m_found.size() && m_found[found] < pair.key) {
+            addPair(grid, m_found[found++]);
+        }
+        
+        int a = static_cast<int>(pair.key >> 32);
+        int b = static_cast<int>(pair.key & 0xFFFFFFFFu);
+        
+        // Freed handles may already belong to new items, which are found
+        // (and begin) under the same key
+        bool removedA = (m_flags[a] & kRemoved) != 0;
+        bool removedB = (m_flags[b] & kRemoved) != 0;
+        if (removedA || removedB) {
+            m_events.push_back({removedA ? -1 : grid.getUserIndex(a), removedB ? -1 : grid.getUserIndex(b),
+                                pair.idA, pair.idB, ContactPhase::END});
+            continue;
+        }
+        
+        // Found again, or neither side moved so it cannot have changed
+        bool stays = found < m_found.size() && m_found[found] == pair.key;
+        if (stays) {
+            found++;
+        } else {
+            stays = ((m_flags[a] | m_flags[b]) & kMoved) == 0;
+        }
+        m_events.push_back({grid.getUserIndex(a), grid.getUserIndex(b), pair.idA, pair.idB,
+                            stays ? ContactPhase::STAY : ContactPhase::END});
+        if (stays) {
+            m_merged.push_back(pair);
+        }
+    }
+    while (found < m_found.size()) {
+        addPair(grid, m_found[found++]);
+    }
+    m_pairs.swap(m_merged);
+    
+    for (int handle : grid.getMovedHandles()) {
+        m_flags[handle] = 0;
+    }
+    for (int handle : grid.getRemovedHandles()) {
+        m_flags[handle] = 0;
+    }
+    m_restored.clear();
+    grid.clearChanges();
+}
+
+void PairCache::clear() {
+    m_pairs.clear();
+    m_events.clear();
+    m_restored.clear();
+    m_counts = BroadphaseCounts();
+    m_queried = 0;
+}
+
+void PairCache::getTouchingIds(std::vector<std::pair<int, int>>& ids) const {
+    // Restored pairs are not rebuilt until the next update()
+    if (!m_restored.empty()) {
+        ids = m_restored;
+        return;
+    }
+    ids.clear();
+    for (const Pair& pair : m_pairs) {
+        ids.emplace_back(std::min(pair.idA, pair.idB), std::max(pair.idA, pair.idB));
+    }
+    std::sort(ids.begin(), ids.end());
+}
+
+void PairCache::restoreTouching(const std::vector<std::pair<int, int>>& ids) {
+    m_restored.clear();
+    for (const auto& pair : ids) {
+        m_restored.emplace_back(std::min(pair.first, pair.second), std::max(pair.first, pair.second));
+    }
+    std::sort(m_restored.begin(), m_restored.end());
+}
@@ -0,0 +1,77 @@
+// backend/src/collision/PairCache.h
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include "HierarchicalGrid.h"
+
+enum class ContactPhase : uint8_t {
+    BEGIN,    // Started touching this frame
+    STAY,     // Still touching
+    END       // Stopped touching, or one side left the grid
+};
+
+struct ContactEvent {
+    int userIndexA;    // -1 when that item was removed from the grid
+    int userIndexB;
+    int idA;
+    int idB;
+    ContactPhase phase;
+};
+
+// Persistent set of touching pairs over a HierarchicalGrid.
+// Only items the grid reports as moved (added, or circle or filter changed)
+// are queried, and only pairs with a moved or removed side can end; a pair
+// of two items that did not move is reported as STAY without a test. When
+// a large share of the items moved, one traversal of the grid replaces the
+// per-item queries. The set is a vector sorted by handle pair, merged each
+// frame with the sorted finds, so a frame costs one pass over the touching
+// pairs plus the queries, and allocates nothing once warmed up.
+class PairCache {
+public:
+    // Refresh against the grid after every item has been updated for this
+    // frame. Consumes the grid's moved/removed lists.
+    void update(HierarchicalGrid& grid);
+    void clear();
+    
+    const std::vector<ContactEvent>& getEvents() const { return m_events; }
+    const BroadphaseCounts& getCounts() const { return m_counts; }
+    size_t getPairCount() const { return m_pairs.size(); }
+    size_t getQueriedCount() const { return m_queried; }
+    
+    // Touching pairs by item id, lower id first and sorted, for saving.
+    // Pairs handed to restoreTouching() report STAY rather than BEGIN when
+    // next found.
+    void getTouchingIds(std::vector<std::pair<int, int>>& ids) const;
+    void restoreTouching(const std::vector<std::pair<int, int>>& ids);
+
+private:
+    struct Pair {
+        uint64_t key;    // Lower handle in the high word
+        int idA;
+        int idB;
+    };
+    
+    std::vector<Pair> m_pairs;
+    std::vector<Pair> m_merged;
+    std::vector<uint64_t> m_queryOrder;    // Bin key and handle of each moved item
+    std::vector<uint64_t> m_found;
+    std::vector<uint64_t> m_sortScratch;
+    std::vector<uint8_t> m_flags;       // Per handle; only this frame's changes are set
+    std::vector<std::pair<int, int>> m_restored;
+    std::vector<ContactEvent> m_events;
+    BroadphaseCounts m_counts;
+    size_t m_queried = 0;
+    
+    static constexpr uint8_t kMoved = 1;
+    static constexpr uint8_t kRemoved = 2;
+    
+    // Share of items moved past which a full traversal replaces per-item queries
+    static constexpr float kFullTraversalShare = 0.25f;
+    
+    void addPair(const HierarchicalGrid& grid, uint64_t key);
+    bool wasTouching(int idA, int idB) const;
+    
+    static uint64_t makeKey(int a, int b);
+};
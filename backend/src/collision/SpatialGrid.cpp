@@ -0,0 +1,86 @@
+// backend/src/collision/SpatialGrid.cpp
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+SpatialGrid::SpatialGrid(float cellSize)
+    : m_cellSize(cellSize),
+      m_inverseCellSize(1.0f / cellSize),
+      m_min(0.0f, 0.0f),
+      m_max(800.0f, 600.0f),
+      m_columns(1),
+      m_rows(1),
+      m_maxRadius(0.0f) {
+    updateDimensions();
+}
+
+void SpatialGrid::setBounds(const Vector2& min, const Vector2& max) {
+    if (min.x == m_min.x && min.y == m_min.y && max.x == m_max.x && max.y == m_max.y) {
+        return;
+    }
+    m_min = min;
+    m_max = max;
+    updateDimensions();
+}
+
+void SpatialGrid::setCellSize(float cellSize) {
+    m_cellSize = cellSize;
+    m_inverseCellSize = 1.0f / cellSize;
+    updateDimensions();
+}
+
+void SpatialGrid::updateDimensions() {
+    m_columns = std::max(1, static_cast<int>(std::ceil((m_max.x - m_min.x) * m_inverseCellSize)));
+    m_rows = std::max(1, static_cast<int>(std::ceil((m_max.y - m_min.y) * m_inverseCellSize)));
+    m_cellStart.assign(static_cast<size_t>(m_columns) * m_rows + 1, 0);
+    m_items.clear();
+}
+
+int SpatialGrid::cellX(float x) const {
+    int cell = static_cast<int>((x - m_min.x) * m_inverseCellSize);
+    return std::min(std::max(cell, 0), m_columns - 1);
+}
+
+int SpatialGrid::cellY(float y) const {
+    int cell = static_cast<int>((y - m_min.y) * m_inverseCellSize);
+    return std::min(std::max(cell, 0), m_rows - 1);
+}
+
+void SpatialGrid::clear() {
+    m_staged.clear();
+    m_stagedCell.clear();
+    m_items.clear();
+    m_maxRadius = 0.0f;
+}
+
+void SpatialGrid::insert(int userIndex, const Vector2& position, float radius,
+                         const CollisionFilter& filter, int id) {
+    m_staged.push_back({position.x, position.y, radius, userIndex, filter, id});
+    m_stagedCell.push_back(static_cast<uint32_t>(cellY(position.y) * m_columns + cellX(position.x)));
+    m_maxRadius = std::max(m_maxRadius, radius);
+}
+
+void SpatialGrid::build() {
+    size_t cellCount = static_cast<size_t>(m_columns) * m_rows;
+    
+    // Count items per cell
+    std::fill(m_cellStart.begin(), m_cellStart.end(), 0);
+    for (uint32_t cell : m_stagedCell) {
+        m_cellStart[cell + 1]++;
+    }
+    
+    // Prefix sum gives each cell's first slot
+    for (size_t c = 0; c < cellCount; ++c) {
+        m_cellStart[c + 1] += m_cellStart[c];
+    }
+    
+    // Scatter items into their cells, walking the cursors back afterwards
+    m_items.resize(m_staged.size());
+    for (size_t i = 0; i < m_staged.size(); ++i) {
+        m_items[m_cellStart[m_stagedCell[i]]++] = m_staged[i];
+    }
+    for (size_t c = cellCount; c > 0; --c) {
+        m_cellStart[c] = m_cellStart[c - 1];
+    }
+    m_cellStart[0] = 0;
+}
@@ -0,0 +1,162 @@
+// backend/src/collision/SpatialGrid.h
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include "../vector2.h"
+#include "CollisionFilter.h"
+
+// Work done by a broadphase query
+struct BroadphaseCounts {
+    int distanceTests = 0;      // Pairs that reached the circle overlap test
+    int filteredPairs = 0;      // Pairs rejected by category/mask/ignore id
+    
+    BroadphaseCounts& operator+=(const BroadphaseCounts& other) {
+        distanceTests += other.distanceTests;
+        filteredPairs += other.filteredPairs;
+        return *this;
+    }
+};
+
+// Uniform grid broadphase rebuilt from scratch each frame.
+// Items are bucketed by their centre cell with a counting sort, so cell
+// contents are contiguous and rebuilding allocates nothing once warmed up.
+// Collision filters are checked before the distance test.
+class SpatialGrid {
+public:
+    SpatialGrid(float cellSize = 32.0f);
+    
+    // Area covered by the grid; items outside are clamped to the border cells
+    void setBounds(const Vector2& min, const Vector2& max);
+    void setCellSize(float cellSize);
+    
+    // Stage items, then build() before querying
+    void clear();
+    void insert(int userIndex, const Vector2& position, float radius,
+                const CollisionFilter& filter = CollisionFilter(), int id = -1);
+    void build();
+    
+    // Calls fn(userIndex) for every item that passes the filter and whose
+    // circle overlaps the query circle
+    template<typename Fn>
+    BroadphaseCounts queryCircle(const Vector2& center, float radius, const CollisionFilter& filter, int id, Fn&& fn) const;
+    
+    // Calls fn(userIndexA, userIndexB) once for every pair of overlapping
+    // circles that passes the filters
+    template<typename Fn>
+    BroadphaseCounts forEachOverlappingPair(Fn&& fn) const;
+    
+    int getItemCount() const { return static_cast<int>(m_staged.size()); }
+    float getMaxRadius() const { return m_maxRadius; }
+    
+private:
+    struct Item {
+        float x;
+        float y;
+        float radius;
+        int userIndex;
+        CollisionFilter filter;
+        int id;
+    };
+    
+    float m_cellSize;
+    float m_inverseCellSize;
+    Vector2 m_min;
+    Vector2 m_max;
+    int m_columns;
+    int m_rows;
+    float m_maxRadius;
+    
+    std::vector<Item> m_staged;
+    std::vector<uint32_t> m_stagedCell;
+    
+    // Cell c holds m_items[m_cellStart[c] .. m_cellStart[c + 1])
+    std::vector<uint32_t> m_cellStart;
+    std::vector<Item> m_items;
+    
+    void updateDimensions();
+    int cellX(float x) const;
+    int cellY(float y) const;
+};
+
+template<typename Fn>
+BroadphaseCounts SpatialGrid::queryCircle(const Vector2& center, float radius, const CollisionFilter& filter, int id, Fn&& fn) const {
+    BroadphaseCounts counts;
+    if (m_items.empty()) {
+        return counts;
+    }
+    
+    float reach = radius + m_maxRadius;
+    int x0 = cellX(center.x - reach);
+    int x1 = cellX(center.x + reach);
+    int y0 = cellY(center.y - reach);
+    int y1 = cellY(center.y + reach);
+    
+    for (int y = y0; y <= y1; ++y) {
+        for (int x = x0; x <= x1; ++x) {
+            int cell = y * m_columns + x;
+            for (uint32_t i = m_cellStart[cell]; i < m_cellStart[cell + 1]; ++i) {
+                const Item& item = m_items[i];
+                if (!shouldCollide(filter, id, item.filter, item.id)) {
+                    counts.filteredPairs++;
+                    continue;
+                }
+                
+                counts.distanceTests++;
+                float dx = item.x - center.x;
+                float dy = item.y - center.y;
+                float minDistance = item.radius + radius;
+                if (dx * dx + dy * dy < minDistance * minDistance) {
+                    fn(item.userIndex);
+                }
+            }
+        }
+    }
+    return counts;
+}
+
+template<typename Fn>
+BroadphaseCounts SpatialGrid::forEachOverlappingPair(Fn&& fn) const {
+    BroadphaseCounts counts;
+    int cellCount = m_columns * m_rows;
+    
+    for (int cell = 0; cell < cellCount; ++cell) {
+        for (uint32_t i = m_cellStart[cell]; i < m_cellStart[cell + 1]; ++i) {
+            const Item& a = m_items[i];
+            float reach = a.radius + m_maxRadius;
+            int x0 = cellX(a.x - reach);
+            int x1 = cellX(a.x + reach);
+            int y0 = cellY(a.y - reach);
+            int y1 = cellY(a.y + reach);
+            
+            for (int y = y0; y <= y1; ++y) {
+                for (int x = x0; x <= x1; ++x) {
+                    int other = y * m_columns + x;
+                    
+                    // Each pair is reported from the item with the lower sorted index
+                    if (other < cell) {
+                        continue;
+                    }
+                    uint32_t j = other == cell ? i + 1 : m_cellStart[other];
+                    
+                    for (; j < m_cellStart[other + 1]; ++j) {
+                        const Item& b = m_items[j];
+                        if (!shouldCollide(a.filter, a.id, b.filter, b.id)) {
+                            counts.filteredPairs++;
+                            continue;
+                        }
+                        
+                        counts.distanceTests++;
+                        float dx = b.x - a.x;
+                        float dy = b.y - a.y;
+                        float minDistance = a.radius + b.radius;
+                        if (dx * dx + dy * dy < minDistance * minDistance) {
+                            fn(a.userIndex, b.userIndex);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return counts;
+}
@@ -0,0 +1,55 @@
+// backend/src/concurrency/SpscQueue.h
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+// Bounded single-producer single-consumer queue. push() and pop() never
+// block or allocate; push() fails when the queue is full. Exactly one
+// thread may push and exactly one (possibly different) thread may pop.
+template<typename T, size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    
+public:
+    SpscQueue() : m_head(0), m_tail(0) {}
+    
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+    
+    // Producer side
+    bool push(const T& item) {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head.load(std::memory_order_acquire) >= Capacity) {
+            return false;
+        }
+        m_items[tail & (Capacity - 1)] = item;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+    
+    // Consumer side
+    bool pop(T& item) {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = m_items[head & (Capacity - 1)];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+    
+    // Approximate when called concurrently with push/pop
+    size_t size() const {
+        return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+    }
+    
+    bool empty() const { return size() == 0; }
+    static constexpr size_t capacity() { return Capacity; }
+    
+private:
+    // Head and tail sit on separate cache lines to avoid false sharing
+    alignas(64) std::atomic<size_t> m_head;
+    alignas(64) std::atomic<size_t> m_tail;
+    alignas(64) T m_items[Capacity];
+};
@@ -0,0 +1,88 @@
+// backend/src/concurrency/ThreadPool.cpp
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(int workerCount)
+    : m_generation(0),
+      m_stopping(false),
+      m_task(nullptr),
+      m_context(nullptr),
+      m_taskCount(0),
+      m_nextTask(0),
+      m_busyWorkers(0) {
+    for (int i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&ThreadPool::workerMain, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+}
+
+int ThreadPool::defaultWorkerCount() {
+#ifdef __EMSCRIPTEN__
+    return 0;
+#else
+    int hardware = static_cast<int>(std::thread::hardware_concurrency());
+    return hardware > 1 ? hardware - 1 : 0;
+#endif
+}
+
+void ThreadPool::dispatch(int count, TaskFn task, void* context) {
+    if (m_workers.empty() || count <= 1) {
+        for (int i = 0; i < count; ++i) {
+            task(context, i);
+        }
+        return;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = task;
+        m_context = context;
+        m_taskCount = count;
+        m_nextTask.store(0);
+        m_busyWorkers.store(static_cast<int>(m_workers.size()));
+        m_generation++;
+    }
+    m_wake.notify_all();
+    
+    // The caller works too, then waits for the workers to drain
+    runTasks();
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return m_busyWorkers.load() == 0; });
+}
+
+void ThreadPool::runTasks() {
+    for (int index = m_nextTask.fetch_add(1); index < m_taskCount; index = m_nextTask.fetch_add(1)) {
+        m_task(m_context, index);
+    }
+}
+
+void ThreadPool::workerMain() {
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&] { return m_stopping || m_generation != seen; });
+            if (m_stopping) {
+                return;
+            }
+            seen = m_generation;
+        }
+        
+        runTasks();
+        
+        // Take the lock so the notification cannot slip in before dispatch() waits
+        if (m_busyWorkers.fetch_sub(1) == 1) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_done.notify_one();
+        }
+    }
+}
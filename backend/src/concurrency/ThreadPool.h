@@ -0,0 +1,58 @@
+// backend/src/concurrency/ThreadPool.h
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Fork-join pool for splitting one step of work into independent tasks.
+// parallelFor() hands task indices out through an atomic counter, runs
+// tasks on the calling thread as well, and returns once every task has
+// finished. Which thread runs a task is not deterministic, so tasks must
+// not depend on each other. With no workers (always the case in
+// single-threaded WebAssembly) everything runs inline, in index order.
+class ThreadPool {
+public:
+    explicit ThreadPool(int workerCount = defaultWorkerCount());
+    ~ThreadPool();
+    
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    
+    // Calls fn(index) for every index in [0, count)
+    template<typename Fn>
+    void parallelFor(int count, Fn&& fn) {
+        using Callable = typename std::remove_reference<Fn>::type;
+        dispatch(count, [](void* context, int index) { (*static_cast<Callable*>(context))(index); }, &fn);
+    }
+    
+    int getWorkerCount() const { return static_cast<int>(m_workers.size()); }
+    
+    // One less than the hardware threads, leaving the caller's; 0 in WebAssembly
+    static int defaultWorkerCount();
+
+private:
+    using TaskFn = void (*)(void* context, int index);
+    
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    uint64_t m_generation;
+    bool m_stopping;
+    
+    // The job being run
+    TaskFn m_task;
+    void* m_context;
+    int m_taskCount;
+    std::atomic<int> m_nextTask;
+    std::atomic<int> m_busyWorkers;
+    
+    void dispatch(int count, TaskFn task, void* context);
+    void runTasks();
+    void workerMain();
+};
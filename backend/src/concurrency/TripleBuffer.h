@@ -0,0 +1,52 @@
+// backend/src/concurrency/TripleBuffer.h
+#pragma once
+
+#include <atomic>
+
+// Hands the latest value from one producer thread to one consumer thread
+// without locks or waiting. The producer fills its private buffer and
+// publishes it; the consumer swaps in whatever was published last. A
+// consumer that falls behind skips stale values, and one that asks again
+// before anything new was published keeps its current buffer, so neither
+// side ever holds up the other. Values are reused, not reconstructed, so
+// containers inside T keep their capacity.
+template<typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() : m_writeIndex(0), m_shared(1), m_readIndex(2) {}
+    
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+    
+    // Producer side: fill this, then publish()
+    T& getWriteBuffer() { return m_buffers[m_writeIndex]; }
+    
+    void publish() {
+        int previous = m_shared.exchange(m_writeIndex | kFresh, std::memory_order_acq_rel);
+        m_writeIndex = previous & kIndexMask;
+    }
+    
+    // Consumer side: returns true when a newer value was swapped in
+    bool acquire() {
+        if (!(m_shared.load(std::memory_order_relaxed) & kFresh)) {
+            return false;
+        }
+        int previous = m_shared.exchange(m_readIndex, std::memory_order_acq_rel);
+        m_readIndex = previous & kIndexMask;
+        return true;
+    }
+    
+    const T& getReadBuffer() const { return m_buffers[m_readIndex]; }
+
+private:
+    // The shared slot's index, plus whether it holds an unread value
+    static constexpr int kIndexMask = 3;
+    static constexpr int kFresh = 4;
+    
+    T m_buffers[3];
+    
+    // Each index is only touched by its own side; keep them apart
+    alignas(64) int m_writeIndex;
+    alignas(64) std::atomic<int> m_shared;
+    alignas(64) int m_readIndex;
+};
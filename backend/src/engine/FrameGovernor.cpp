@@ -0,0 +1,78 @@
+// backend/src/engine/FrameGovernor.cpp
+#include "FrameGovernor.h"
+
+namespace {
+// Cheapest losses first: AI detail, then audio and spawning. Every step
+// sheds real work; cosmetics cost almost nothing and go with the first one.
+constexpr DegradationLevel kLevels[FrameGovernor::kLevelCount] = {
+    {1.0f, 32, 4, true},
+    {2.0f, 24, 3, false},
+    {3.0f, 16, 2, false},
+    {4.0f, 8, 1, false},
+};
+
+// Weight of the newest tick in the smoothed costs
+const float kSmoothing = 0.2f;
+
+// Ticks over budget before degrading, and with headroom before restoring
+const int kDegradeTicks = 5;
+const int kRestoreTicks = 60;
+
+// Restore only once the tick costs less than this fraction of the budget
+const float kRestoreRatio = 0.6f;
+}
+
+FrameGovernor::FrameGovernor()
+    : m_budgetMs(8.0f),
+      m_enabled(true) {
+    reset();
+}
+
+void FrameGovernor::reset() {
+    m_level = 0;
+    m_tickMs = 0.0f;
+    for (float& phase : m_phaseMs) {
+        phase = 0.0f;
+    }
+    m_overTicks = 0;
+    m_headroomTicks = 0;
+}
+
+void FrameGovernor::setEnabled(bool enabled) {
+    m_enabled = enabled;
+    if (!enabled) {
+        reset();
+    }
+}
+
+const DegradationLevel& FrameGovernor::getSettings(int level) {
+    return kLevels[level];
+}
+
+bool FrameGovernor::update(const float phaseMs[static_cast<int>(FramePhase::COUNT)]) {
+    float tickMs = 0.0f;
+    for (int i = 0; i < static_cast<int>(FramePhase::COUNT); ++i) {
+        m_phaseMs[i] += (phaseMs[i] - m_phaseMs[i]) * kSmoothing;
+        tickMs += phaseMs[i];
+    }
+    m_tickMs += (tickMs - m_tickMs) * kSmoothing;
+    
+    if (!m_enabled) {
+        return false;
+    }
+    
+    m_overTicks = m_tickMs > m_budgetMs ? m_overTicks + 1 : 0;
+    m_headroomTicks = m_tickMs < m_budgetMs * kRestoreRatio ? m_headroomTicks + 1 : 0;
+    
+    if (m_overTicks >= kDegradeTicks && m_level < kLevelCount - 1) {
+        m_level++;
+        m_overTicks = 0;
+        return true;
+    }
+    if (m_headroomTicks >= kRestoreTicks && m_level > 0) {
+        m_level--;
+        m_headroomTicks = 0;
+        return true;
+    }
+    return false;
+}
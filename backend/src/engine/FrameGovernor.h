@@ -0,0 +1,63 @@
+// backend/src/engine/FrameGovernor.h
+#pragma once
+
+// What optional work runs at one degradation level
+struct DegradationLevel {
+    float aiLodScale;       // AIScheduler::setLodScale
+    int voiceLimit;         // AudioManager::setVoiceLimit
+    int spawnBudget;        // Wave drones spawned per frame
+    bool effects;           // Cosmetic updates such as power-up pulsing
+};
+
+// Engine phases the governor tracks
+enum class FramePhase {
+    PHYSICS,
+    GAME_LOGIC,
+    AUDIO,
+    COUNT
+};
+
+// Back-pressure for the engine tick. Each tick reports what its phases
+// cost; the governor smooths the total and steps down one level of
+// optional work after several ticks over budget, and back up after a
+// longer run with clear headroom. The gap between the two thresholds keeps
+// it from oscillating around the budget. It only chooses a level; the
+// engine applies it.
+class FrameGovernor {
+public:
+    static constexpr int kLevelCount = 4;
+    
+    FrameGovernor();
+    
+    // Record one tick's phase costs; returns true when the level changed
+    bool update(const float phaseMs[static_cast<int>(FramePhase::COUNT)]);
+    
+    // Level 0 runs everything; higher levels drop more optional work
+    int getLevel() const { return m_level; }
+    const DegradationLevel& getSettings() const { return getSettings(m_level); }
+    static const DegradationLevel& getSettings(int level);
+    
+    // Smoothed cost of the whole tick and of each phase
+    float getTickMs() const { return m_tickMs; }
+    float getPhaseMs(FramePhase phase) const { return m_phaseMs[static_cast<int>(phase)]; }
+    
+    // Configuration
+    void setBudget(float milliseconds) { m_budgetMs = milliseconds; }
+    float getBudget() const { return m_budgetMs; }
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return m_enabled; }
+    
+    // Back to level 0 with no history
+    void reset();
+
+private:
+    float m_budgetMs;
+    bool m_enabled;
+    int m_level;
+    float m_tickMs;
+    float m_phaseMs[static_cast<int>(FramePhase::COUNT)];
+    
+    // Consecutive ticks over budget, and under the restore threshold
+    int m_overTicks;
+    int m_headroomTicks;
+};
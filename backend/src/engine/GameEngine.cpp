@@ -1,12 +1,24 @@
 // backend/src/engine/GameEngine.cpp
 #include "GameEngine.h"
+#include "../profiling/Profiler.h"
+#include "../memory/AllocationTracker.h"
+#include <chrono>
 #include <iostream>
 
+namespace {
+using Clock = std::chrono::steady_clock;
+
+float elapsedMs(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration<float, std::milli>(end - start).count();
+}
+}
+
 GameEngine::GameEngine()
     : m_worldWidth(800.0f),
       m_worldHeight(600.0f),
       m_gravity(9.8f),
-      m_initialized(false) {
+      m_initialized(false),
+      m_simulationRunning(false) {
 }
 
 GameEngine::~GameEngine() {
@@ -42,12 +54,19 @@ bool GameEngine::initialize() {
     try {
         m_game = std::make_unique<Game>();
         m_game->setWorldSize(m_worldWidth, m_worldHeight);
+        m_game->setFrameArena(&m_frameArena);
         m_game->initialize();
+        
+        // Bodies act on the game's transforms directly
+        m_physicsWorld->setTransforms(&m_game->getTransforms());
     } catch (const std::exception& e) {
         std::cerr << "Failed to initialize game: " << e.what() << std::endl;
         return false;
     }
     
+    // Fresh subsystems run at full detail
+    m_governor.reset();
+    
     m_initialized = true;
     return true;
 }
@@ -57,17 +76,157 @@ void GameEngine::update(float deltaTime) {
         return;
     }
     
-    // Update physics
-    m_physicsWorld->update(deltaTime);
+    AllocationTracker::Snapshot allocationsAtStart = AllocationTracker::snapshot();
+    Clock::time_point physicsStart;
+    Clock::time_point gameStart;
+    Clock::time_point audioStart;
+    Clock::time_point audioEnd;
+    
+    PROFILE_BEGIN_FRAME();
+    {
+        PROFILE_ZONE("GameEngine::update");
+        
+        // Update physics
+        {
+            PROFILE_ZONE("Physics");
+            physicsStart = Clock::now();
+            m_physicsWorld->update(deltaTime);
+        }
+        
+        // Update game logic
+        {
+            PROFILE_ZONE("GameLogic");
+            gameStart = Clock::now();
+            m_game->update(deltaTime);
+        }
+        
+        // Play this frame's gameplay events, then update audio
+        {
+            PROFILE_ZONE("Audio");
+            audioStart = Clock::now();
+            m_audioManager->drainEvents(m_game->getEvents());
+            m_audioManager->update(deltaTime);
+            audioEnd = Clock::now();
+        }
+    }
+    PROFILE_END_FRAME();
+    
+    // Game counters plus the engine-level phases and whole-tick allocations
+    AllocationTracker::Snapshot allocations = AllocationTracker::since(allocationsAtStart, AllocationTracker::snapshot());
+    m_stats = m_game->getStats();
+    m_stats.physicsMs = elapsedMs(physicsStart, gameStart);
+    m_stats.gameLogicMs = elapsedMs(gameStart, audioStart);
+    m_stats.audioMs = elapsedMs(audioStart, audioEnd);
+    const PhysicsStats& physics = m_physicsWorld->getStats();
+    m_stats.physicsContacts = static_cast<uint32_t>(physics.contacts);
+    m_stats.physicsIterations = static_cast<uint32_t>(physics.velocityIterations);
+    m_stats.physicsResidual = physics.residual;
+    m_stats.allocations = static_cast<uint32_t>(allocations.allocations);
+    m_stats.allocatedBytes = static_cast<uint32_t>(allocations.bytes);
     
-    // Update game logic
-    m_game->update(deltaTime);
+    // Wall-clock back-pressure would make deterministic runs machine-dependent
+    bool governed = !m_game->isDeterministic();
+    if (governed != m_governor.isEnabled()) {
+        m_governor.setEnabled(governed);
+        applyDegradation();
+    }
+    float phaseMs[static_cast<int>(FramePhase::COUNT)] = {m_stats.physicsMs, m_stats.gameLogicMs, m_stats.audioMs};
+    if (m_governor.update(phaseMs)) {
+        applyDegradation();
+    }
+    m_stats.degradationLevel = static_cast<uint32_t>(m_governor.getLevel());
+    m_stats.governedTickMs = m_governor.getTickMs();
     
-    // Update audio
-    m_audioManager->update(deltaTime);
+    // Everything allocated from the frame arena this tick is released here
+    m_stats.arenaUsedBytes = static_cast<uint32_t>(m_frameArena.getUsed());
+    m_frameArena.reset();
+    m_stats.arenaHighWaterBytes = static_cast<uint32_t>(m_frameArena.getHighWaterMark());
+}
+
+void GameEngine::applyDegradation() {
+    applyDegradation(m_governor.getSettings(), *m_game, m_audioManager.get());
+}
+
+void GameEngine::applyDegradation(const DegradationLevel& settings, Game& game, AudioManager* audio) {
+    game.getAIScheduler().setLodScale(settings.aiLodScale);
+    game.getWaveDirector().setSpawnBudget(settings.spawnBudget);
+    game.setEffectsEnabled(settings.effects);
+    if (audio) {
+        audio->setVoiceLimit(settings.voiceLimit);
+    }
+}
+
+bool GameEngine::startSimulationThread(float ticksPerSecond) {
+#ifdef __EMSCRIPTEN__
+    (void)ticksPerSecond;
+    return false;
+#else
+    if (!m_initialized || ticksPerSecond <= 0.0f || isSimulationThreadRunning()) {
+        return false;
+    }
+    
+    m_simulationRunning.store(true);
+    m_simulationThread = std::thread(&GameEngine::simulationMain, this, ticksPerSecond);
+    return true;
+#endif
+}
+
+void GameEngine::stopSimulationThread() {
+    if (!isSimulationThreadRunning()) {
+        return;
+    }
+    m_simulationRunning.store(false);
+    m_simulationThread.join();
+}
+
+bool GameEngine::postInput(PlayerInput input, bool pressed) {
+    return m_inputs.push({input, pressed});
+}
+
+void GameEngine::simulationMain(float ticksPerSecond) {
+    const float deltaTime = 1.0f / ticksPerSecond;
+    const auto tickLength = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(deltaTime));
+    
+    // After a stall longer than this, drop the missed ticks instead of
+    // running them back to back
+    const int kMaxCatchUpTicks = 4;
+    
+    uint64_t tick = 0;
+    uint32_t skippedTicks = 0;
+    Clock::time_point nextTick = Clock::now();
+    
+    while (m_simulationRunning.load(std::memory_order_relaxed)) {
+        InputEvent event;
+        while (m_inputs.pop(event)) {
+            m_game->handleInput(event.input, event.pressed);
+        }
+        
+        update(deltaTime);
+        tick++;
+        
+        // Fill the private buffer and hand it over; the reader never blocks this
+        SimulationFrame& frame = m_frames.getWriteBuffer();
+        frame.tick = tick;
+        frame.skippedTicks = skippedTicks;
+        frame.state = m_game->getState();
+        frame.stats = m_stats;
+        frame.drawList.build(*m_game);
+        m_frames.publish();
+        
+        nextTick += tickLength;
+        Clock::time_point now = Clock::now();
+        if (now - nextTick > tickLength * kMaxCatchUpTicks) {
+            skippedTicks += static_cast<uint32_t>((now - nextTick) / tickLength);
+            nextTick = now;
+        }
+        std::this_thread::sleep_until(nextTick);
+    }
 }
 
 void GameEngine::shutdown() {
+    // The simulation thread uses every subsystem
+    stopSimulationThread();
+    
     // Destroy in reverse order of creation
     m_game.reset();
     m_audioManager.reset();
@@ -1,19 +1,36 @@
 // backend/src/engine/GameEngine.h
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <vector>
 #include <string>
+#include <thread>
 #include "Game.h"
+#include "GameStats.h"
+#include "FrameGovernor.h"
+#include "../concurrency/SpscQueue.h"
+#include "../concurrency/TripleBuffer.h"
+#include "../memory/FrameArena.h"
+#include "../render/DrawList.h"
 #include "../physics/PhysicsWorld.h"
 #include "../audio/AudioManager.h"
 
+// One completed simulation tick, as published to presentation
+struct SimulationFrame {
+    uint64_t tick = 0;              // Ticks simulated since the thread started
+    uint32_t skippedTicks = 0;      // Ticks dropped so far to catch up after stalls
+    GameState state = GameState::MENU;
+    GameStats stats;
+    DrawList drawList;
+};
+
 // Main game engine class that coordinates all systems
 class GameEngine {
 public:
     GameEngine();
     ~GameEngine();
-
+    
     // Initialize the engine and all subsystems
     bool initialize();
     
@@ -23,6 +40,22 @@ public:
     // Shutdown the engine and all subsystems
     void shutdown();
     
+    // Native builds can run update() on a dedicated thread at a fixed
+    // rate instead. While it runs, nothing else may call update() or touch
+    // the game; other threads post input and read completed frames.
+    // Returns false where threads are unavailable (WebAssembly).
+    bool startSimulationThread(float ticksPerSecond = 60.0f);
+    void stopSimulationThread();
+    bool isSimulationThreadRunning() const { return m_simulationThread.joinable(); }
+    
+    // One producer thread: queue input for the next tick; false when full
+    bool postInput(PlayerInput input, bool pressed);
+    
+    // One consumer thread: swap in the newest completed frame, returning
+    // true if it is newer than the last one. Never waits for the simulation.
+    bool acquireFrame() { return m_frames.acquire(); }
+    const SimulationFrame& getFrame() const { return m_frames.getReadBuffer(); }
+    
     // Get game instance
     Game* getGame() const { return m_game.get(); }
     
@@ -32,6 +65,20 @@ public:
     // Get audio manager
     AudioManager* getAudioManager() const { return m_audioManager.get(); }
     
+    // Scratch memory for the current tick; reset when update() returns
+    FrameArena& getFrameArena() { return m_frameArena; }
+    
+    // Degrades optional work while ticks run over budget; disabled while
+    // the game is deterministic, since it reacts to wall time
+    FrameGovernor& getGovernor() { return m_governor; }
+    
+    // Apply a governor level to a game and its mixer (if any). Shared with
+    // the WebAssembly bindings, which drive a Game without an engine.
+    static void applyDegradation(const DegradationLevel& settings, Game& game, AudioManager* audio);
+    
+    // Statistics for the last tick, including per-phase timings
+    const GameStats& getStats() const { return m_stats; }
+    
     // Configuration methods
     void setWorldSize(float width, float height);
     void setGravity(float gravity);
@@ -53,6 +100,27 @@ private:
     float m_worldHeight;
     float m_gravity;
     
+    // Per-tick scratch memory shared by the subsystems
+    FrameArena m_frameArena;
+    
+    // Last tick's statistics
+    GameStats m_stats;
+    
+    FrameGovernor m_governor;
+    
     // Initialization state
     bool m_initialized;
+    
+    // Simulation thread, its input queue and its published frames
+    struct InputEvent {
+        PlayerInput input;
+        bool pressed;
+    };
+    std::thread m_simulationThread;
+    std::atomic<bool> m_simulationRunning;
+    SpscQueue<InputEvent, 256> m_inputs;
+    TripleBuffer<SimulationFrame> m_frames;
+    
+    void applyDegradation();
+    void simulationMain(float ticksPerSecond);
 };
\ No newline at end of file
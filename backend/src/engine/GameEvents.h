@@ -0,0 +1,90 @@
+// backend/src/engine/GameEvents.h
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+// Keep the values stable; the frontend switches on them
+enum class GameEventType : uint32_t {
+    PLAYER_DAMAGED = 0,     // value = damage taken, otherId = source
+    PLAYER_DIED = 1,
+    DRONE_SPAWNED = 2,      // value = DroneType
+    DRONE_DESTROYED = 3,    // otherId = what destroyed it
+    POWERUP_COLLECTED = 4,  // value = PowerUpType
+    PROJECTILE_FIRED = 5,   // entityId = shooter
+    COUNT
+};
+
+// One gameplay side effect. Every field is 4 bytes so a batch can be
+// memcpy'd out and read through one Uint32Array/Float32Array pair; keep
+// the order in sync with wasmModule.js.
+struct GameEvent {
+    GameEventType type;
+    uint32_t frame;
+    int32_t entityId;
+    int32_t otherId;        // -1 when there is none
+    float x;
+    float y;
+    float value;
+};
+
+static_assert(std::is_trivially_copyable<GameEvent>::value, "GameEvent is copied out with memcpy");
+static_assert(sizeof(GameEvent) == 7 * 4, "GameEvent layout changed; update wasmModule.js");
+
+// Fixed-size ring of the most recent events, written by Game::update.
+// Readers keep their own sequence cursor and copy out everything newer in
+// bulk, so the audio mixer and the frontend drain the same stream
+// independently. A reader more than Capacity events behind loses the
+// oldest ones; read() reports how many.
+class GameEventBus {
+public:
+    static constexpr size_t kCapacity = 1024;
+    
+    // Frame number stamped on the events that follow
+    void setFrame(uint32_t frame) { m_frame = frame; }
+    
+    void emit(GameEventType type, int32_t entityId, int32_t otherId, float x, float y, float value = 0.0f) {
+        m_events[m_written % kCapacity] = {type, m_frame, entityId, otherId, x, y, value};
+        m_written++;
+    }
+    
+    // Total events ever pushed; the cursor of a reader that is up to date
+    uint64_t getSequence() const { return m_written; }
+    
+    // Copy up to maxCount events after cursor into out and advance cursor.
+    // Returns the number copied; dropped, if given, receives the number of
+    // events that were overwritten before this reader got to them.
+    size_t read(uint64_t& cursor, GameEvent* out, size_t maxCount, uint64_t* dropped = nullptr) const {
+        // A cursor past the end belongs to a bus this one replaced
+        uint64_t oldest = m_written > kCapacity ? m_written - kCapacity : 0;
+        if (cursor > m_written) {
+            cursor = oldest;
+        }
+        uint64_t lost = cursor < oldest ? oldest - cursor : 0;
+        if (dropped) {
+            *dropped = lost;
+        }
+        cursor += lost;
+        
+        size_t count = static_cast<size_t>(m_written - cursor);
+        count = count < maxCount ? count : maxCount;
+        if (count == 0) {
+            return 0;
+        }
+        
+        // At most two runs: up to the end of the ring, then from the start
+        size_t start = static_cast<size_t>(cursor % kCapacity);
+        size_t first = count < kCapacity - start ? count : kCapacity - start;
+        std::memcpy(out, m_events + start, first * sizeof(GameEvent));
+        std::memcpy(out + first, m_events, (count - first) * sizeof(GameEvent));
+        cursor += count;
+        return count;
+    }
+
+private:
+    GameEvent m_events[kCapacity];
+    uint64_t m_written = 0;
+    uint32_t m_frame = 0;
+};
@@ -0,0 +1,107 @@
+// backend/src/engine/GameStats.h
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+// Bump when fields are added; readers check it before decoding
+constexpr uint32_t kGameStatsVersion = 8;
+
+// Number of frames covered by the rolling averages
+constexpr int kStatsWindow = 60;
+
+// Runtime statistics copied out to the frontend every frame.
+// Every field is 4 bytes so JavaScript can read the block through one
+// Uint32Array/Float32Array pair; keep the order in sync with wasmModule.js.
+struct GameStats {
+    uint32_t version = kGameStatsVersion;
+    uint32_t frame = 0;
+    float simulationTime = 0.0f;     // Seconds simulated since initialize()
+    float frameTimeMs = 0.0f;        // Wall time of the last Game::update
+    
+    // Live entities indexed by EntityType (projectiles include the pool)
+    uint32_t entityCounts[4] = {0, 0, 0, 0};
+    
+    // Counters reset every frame
+    uint32_t pairTests = 0;          // Narrowphase distance tests
+    uint32_t collisions = 0;         // Entity pairs dispatched to handleCollision
+    uint32_t projectileHits = 0;
+    uint32_t allocations = 0;        // Global heap allocations during the frame
+    uint32_t allocatedBytes = 0;
+    
+    // AI scheduler
+    uint32_t aiThinks = 0;
+    uint32_t aiDeferred = 0;
+    uint32_t aiBudgetOverruns = 0;   // Cumulative
+    float aiCostMs = 0.0f;
+    float aiCostUsPerThink[3] = {0.0f, 0.0f, 0.0f};  // Average by DroneType
+    
+    // Engine phases; filled by GameEngine and the WebAssembly bindings
+    // (which have no physics world, so physicsMs stays 0 there)
+    float physicsMs = 0.0f;
+    float gameLogicMs = 0.0f;
+    float audioMs = 0.0f;
+    
+    // Rolling averages over the last kStatsWindow frames
+    float avgFrameTimeMs = 0.0f;
+    float avgPairTests = 0.0f;
+    float avgCollisions = 0.0f;
+    float avgAllocations = 0.0f;
+    
+    // Frame arena usage
+    uint32_t arenaUsedBytes = 0;
+    uint32_t arenaHighWaterBytes = 0;
+    
+    // Pairs rejected by collision filters before the distance test
+    uint32_t filteredPairs = 0;
+    
+    // Persistent pair cache
+    uint32_t cachedPairs = 0;        // Touching pairs kept by the pair cache
+    uint32_t contactBegins = 0;
+    uint32_t contactEnds = 0;
+    uint32_t broadphaseMoved = 0;    // Entities that moved and were re-paired
+    
+    // Entity timing wheel
+    uint32_t timersPending = 0;
+    uint32_t timersFired = 0;        // Timers that came due this frame
+    
+    // Contact solver; only filled when running under GameEngine
+    uint32_t physicsContacts = 0;
+    uint32_t physicsIterations = 0;  // Velocity iterations run
+    float physicsResidual = 0.0f;    // Largest impulse change in the last iteration
+    
+    // Wave director
+    uint32_t wave = 0;               // Waves started this match
+    uint32_t pendingSpawns = 0;      // Wave drones waiting for spawn budget or room
+    
+    // Frame governor; filled by GameEngine and the WebAssembly bindings
+    uint32_t degradationLevel = 0;   // 0 runs all optional work
+    float governedTickMs = 0.0f;     // Smoothed tick cost the governor acts on
+};
+
+static_assert(std::is_trivially_copyable<GameStats>::value, "GameStats is copied out with memcpy");
+static_assert(sizeof(GameStats) == 43 * 4, "GameStats layout changed; update wasmModule.js");
+
+// Fixed-window running mean
+template<int N>
+class RollingAverage {
+public:
+    void add(float sample) {
+        m_sum += sample - m_samples[m_next];
+        m_samples[m_next] = sample;
+        m_next = (m_next + 1) % N;
+        if (m_count < N) {
+            m_count++;
+        }
+    }
+    
+    float get() const { return m_count > 0 ? static_cast<float>(m_sum / m_count) : 0.0f; }
+    
+    void reset() { *this = RollingAverage(); }
+
+private:
+    float m_samples[N] = {};
+    double m_sum = 0.0;
+    int m_next = 0;
+    int m_count = 0;
+};
@@ -0,0 +1,45 @@
+// backend/src/engine/Random.h
+#pragma once
+
+#include <cstdint>
+
+// Small seeded generator (PCG32) for gameplay randomness. Unlike std::rand
+// its whole state is one value, so it can be saved into replay keyframes
+// and produces the same sequence on every platform.
+class Random {
+public:
+    explicit Random(uint64_t seed = 0) { setSeed(seed); }
+    
+    void setSeed(uint64_t seed) {
+        m_state = 0;
+        nextU32();
+        m_state += seed;
+        nextU32();
+    }
+    
+    uint32_t nextU32() {
+        uint64_t oldState = m_state;
+        m_state = oldState * 6364136223846793005ULL + kIncrement;
+        uint32_t xorShifted = static_cast<uint32_t>(((oldState >> 18u) ^ oldState) >> 27u);
+        uint32_t rotation = static_cast<uint32_t>(oldState >> 59u);
+        return (xorShifted >> rotation) | (xorShifted << ((32u - rotation) & 31u));
+    }
+    
+    // Uniform integer in [0, bound); bound must be positive
+    int nextInt(int bound) {
+        return static_cast<int>(nextU32() % static_cast<uint32_t>(bound));
+    }
+    
+    // Uniform float in [0, 1)
+    float nextFloat() {
+        return static_cast<float>(nextU32() >> 8) * (1.0f / 16777216.0f);
+    }
+    
+    uint64_t getState() const { return m_state; }
+    void setState(uint64_t state) { m_state = state; }
+
+private:
+    static constexpr uint64_t kIncrement = 1442695040888963407ULL;
+    
+    uint64_t m_state;
+};
@@ -0,0 +1,184 @@
+// backend/src/engine/TimingWheel.h
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Hierarchical timing wheel over integer ticks.
+// Level L has 64 slots of 64^L ticks each. A timer sits in the level that
+// matches how far away its deadline is; when a level-0 revolution ends, the
+// next due slot of the level above is cascaded down. advance() therefore
+// only touches the timers that are due, plus the occasional cascade, no
+// matter how many are pending. Slots are intrusive doubly linked lists over
+// a node pool, so schedule() and cancel() are O(1) and allocate nothing
+// once the pool has grown.
+template<typename Payload>
+class TimingWheel {
+public:
+    static constexpr int kSlotBits = 6;
+    static constexpr int kSlots = 1 << kSlotBits;
+    static constexpr int kLevels = 4;     // 2^24 ticks before timers wrap a level
+    
+    TimingWheel() { clear(); }
+    
+    // Drops every timer and restarts the clock at now
+    void clear(uint64_t now = 0);
+    
+    // Fires in the advance() that reaches deadline; deadlines not after the
+    // current tick fire on the next one. Returns a handle for cancel().
+    int schedule(uint64_t deadline, const Payload& payload);
+    void cancel(int handle);
+    uint64_t getDeadline(int handle) const { return m_nodes[handle].deadline; }
+    
+    // Move the clock forward and append the payloads of the timers that came
+    // due to expired, in no particular order. Their handles are freed.
+    void advance(uint64_t ticks, std::vector<Payload>& expired);
+    
+    uint64_t getNow() const { return m_now; }
+    size_t getPendingCount() const { return m_pending; }
+    
+    // Timers moved down a level since the last reset
+    unsigned int getCascades() const { return m_cascades; }
+    void resetCascades() { m_cascades = 0; }
+
+private:
+    struct Node {
+        Payload payload;
+        uint64_t deadline;
+        int prev;
+        int next;
+        int slot;       // level * kSlots + slot, -1 when free
+    };
+    
+    std::vector<Node> m_nodes;
+    std::vector<int> m_freeNodes;
+    int m_heads[kLevels * kSlots];
+    uint64_t m_now;
+    size_t m_pending;
+    unsigned int m_cascades;
+    
+    void link(int handle);
+    void unlink(int handle);
+    int detachSlot(int slot);
+};
+
+template<typename Payload>
+void TimingWheel<Payload>::clear(uint64_t now) {
+    m_nodes.clear();
+    m_freeNodes.clear();
+    for (int& head : m_heads) {
+        head = -1;
+    }
+    m_now = now;
+    m_pending = 0;
+    m_cascades = 0;
+}
+
+template<typename Payload>
+int TimingWheel<Payload>::schedule(uint64_t deadline, const Payload& payload) {
+    int handle;
+    if (!m_freeNodes.empty()) {
+        handle = m_freeNodes.back();
+        m_freeNodes.pop_back();
+    } else {
+        handle = static_cast<int>(m_nodes.size());
+        m_nodes.emplace_back();
+    }
+    
+    Node& node = m_nodes[handle];
+    node.payload = payload;
+    node.deadline = deadline > m_now ? deadline : m_now + 1;
+    link(handle);
+    m_pending++;
+    return handle;
+}
+
+template<typename Payload>
+void TimingWheel<Payload>::cancel(int handle) {
+    unlink(handle);
+    m_nodes[handle].slot = -1;
+    m_freeNodes.push_back(handle);
+    m_pending--;
+}
+
+template<typename Payload>
+void TimingWheel<Payload>::link(int handle) {
+    Node& node = m_nodes[handle];
+    
+    // The level is picked by distance, the slot by the deadline's own bits
+    uint64_t delta = node.deadline - m_now;
+    int level = 0;
+    while (level < kLevels - 1 && delta >= (uint64_t(1) << (kSlotBits * (level + 1)))) {
+        level++;
+    }
+    node.slot = level * kSlots + static_cast<int>((node.deadline >> (kSlotBits * level)) & (kSlots - 1));
+    
+    int& head = m_heads[node.slot];
+    node.prev = -1;
+    node.next = head;
+    if (head >= 0) {
+        m_nodes[head].prev = handle;
+    }
+    head = handle;
+}
+
+template<typename Payload>
+void TimingWheel<Payload>::unlink(int handle) {
+    Node& node = m_nodes[handle];
+    if (node.prev >= 0) {
+        m_nodes[node.prev].next = node.next;
+    } else {
+        m_heads[node.slot] = node.next;
+    }
+    if (node.next >= 0) {
+        m_nodes[node.next].prev = node.prev;
+    }
+}
+
+template<typename Payload>
+int TimingWheel<Payload>::detachSlot(int slot) {
+    int head = m_heads[slot];
+    m_heads[slot] = -1;
+    return head;
+}
+
+template<typename Payload>
+void TimingWheel<Payload>::advance(uint64_t ticks, std::vector<Payload>& expired) {
+    for (uint64_t t = 0; t < ticks; ++t) {
+        m_now++;
+        
+        // End of a level-0 revolution: bring the next slot of each level
+        // above down, stopping at the first level that has not wrapped
+        if ((m_now & (kSlots - 1)) == 0) {
+            for (int level = 1; level < kLevels; ++level) {
+                int index = static_cast<int>((m_now >> (kSlotBits * level)) & (kSlots - 1));
+                for (int h = detachSlot(level * kSlots + index); h >= 0;) {
+                    int next = m_nodes[h].next;
+                    link(h);
+                    m_cascades++;
+                    h = next;
+                }
+                if (index != 0) {
+                    break;
+                }
+            }
+        }
+        
+        // Everything in the current slot is due, except timers far enough
+        // out to have wrapped the top level
+        for (int h = detachSlot(static_cast<int>(m_now & (kSlots - 1))); h >= 0;) {
+            Node& node = m_nodes[h];
+            int next = node.next;
+            if (node.deadline <= m_now) {
+                expired.push_back(node.payload);
+                node.slot = -1;
+                m_freeNodes.push_back(h);
+                m_pending--;
+            } else {
+                link(h);
+            }
+            h = next;
+        }
+    }
+}
@@ -0,0 +1,95 @@
+// backend/src/entities/Archetypes.h
+#pragma once
+
+#include <cstdint>
+#include "../Drone.h"
+#include "../Player.h"
+#include "../include/Projectile.h"
+#include "../include/PowerUp.h"
+#include "../ai/AIScheduler.h"
+#include "../collision/CollisionFilter.h"
+
+// Tuning for every kind of entity, fixed at compile time and indexed by
+// the type enums. Constructors copy nothing from here that can be looked
+// up instead, so changing a row changes every live entity of that kind.
+
+struct DroneArchetype {
+    float speed;
+    float fireRate;        // Seconds between shots; 0 never fires
+    float radius;
+    bool chasesPlayer;     // Retargets at the player on every decision
+    bool patrols;          // Sweeps back and forth
+};
+
+constexpr DroneArchetype kDroneArchetypes[] = {
+    {150.0f, 0.0f, 12.0f, true, false},     // CHASER
+    {100.0f, 2.0f, 12.0f, false, true},     // PATROLLER
+    {50.0f, 1.0f, 12.0f, false, false},     // SHOOTER: mostly stays in place
+};
+
+struct ProjectileArchetype {
+    float speed;
+    float lifetime;
+    float radius;
+    uint16_t targets;      // Categories the projectile damages
+};
+
+constexpr ProjectileArchetype kProjectileArchetypes[] = {
+    {400.0f, 2.0f, 5.0f, CollisionCategory::DRONE},     // PLAYER
+    {250.0f, 2.0f, 5.0f, CollisionCategory::PLAYER},    // ENEMY
+};
+
+struct PowerUpArchetype {
+    float value;
+    float lifetime;
+    float radius;
+};
+
+constexpr PowerUpArchetype kPowerUpArchetypes[] = {
+    {25.0f, 10.0f, 10.0f},    // HEALTH: restore 25 health
+    {1.5f, 10.0f, 10.0f},     // SPEED: 50% speed boost
+    {3.0f, 10.0f, 10.0f},     // SHIELD: seconds of protection
+    {2.0f, 10.0f, 10.0f},     // DAMAGE_BOOST: damage multiplier
+};
+
+static_assert(sizeof(kDroneArchetypes) / sizeof(kDroneArchetypes[0]) == kDroneTypeCount, "One row per DroneType");
+static_assert(sizeof(kProjectileArchetypes) / sizeof(kProjectileArchetypes[0]) == kProjectileTypeCount, "One row per ProjectileType");
+static_assert(sizeof(kPowerUpArchetypes) / sizeof(kPowerUpArchetypes[0]) == kPowerUpTypeCount, "One row per PowerUpType");
+
+constexpr const DroneArchetype& getArchetype(DroneType type) {
+    return kDroneArchetypes[static_cast<int>(type)];
+}
+
+constexpr const ProjectileArchetype& getArchetype(ProjectileType type) {
+    return kProjectileArchetypes[static_cast<int>(type)];
+}
+
+constexpr const PowerUpArchetype& getArchetype(PowerUpType type) {
+    return kPowerUpArchetypes[static_cast<int>(type)];
+}
+
+// Whether a class does anything in update(). The game keeps entities
+// grouped by class and only runs the per-tick loop for the classes that
+// need it, calling update() non-virtually.
+template<typename T>
+struct EntityTraits;
+
+template<>
+struct EntityTraits<Player> {
+    static constexpr bool kUpdatesEveryTick = true;     // Input to velocity, fire cooldown
+};
+
+template<>
+struct EntityTraits<Drone> {
+    static constexpr bool kUpdatesEveryTick = false;    // Decides in think(), fires on a timer
+};
+
+template<>
+struct EntityTraits<Projectile> {
+    static constexpr bool kUpdatesEveryTick = false;    // Expires on a timer
+};
+
+template<>
+struct EntityTraits<PowerUp> {
+    static constexpr bool kUpdatesEveryTick = true;     // Pulse animation
+};
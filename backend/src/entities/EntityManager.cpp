@@ -45,24 +45,57 @@ void EntityManager::removeInactiveEntities() {
 }
 
 void EntityManager::registerEntityType(const std::string& typeName, EntityFactory factory) {
-    m_entityFactories[typeName] = factory;
+    registerPrefab(typeName, [factory](const Vector2* positions, size_t count,
+                                       std::vector<std::shared_ptr<Entity>>& out) {
+        for (size_t i = 0; i < count; ++i) {
+            auto entity = factory(positions[i]);
+            if (entity) {
+                out.push_back(entity);
+            }
+        }
+    });
 }
 
 std::shared_ptr<Entity> EntityManager::createEntityByType(const std::string& typeName, const Vector2& position) {
-    auto it = m_entityFactories.find(typeName);
-    if (it == m_entityFactories.end()) {
-        return nullptr;
+    size_t first = spawnBatch(findPrefab(typeName), 1, &position);
+    return first < m_entities.size() ? m_entities[first] : nullptr;
+}
+
+PrefabId EntityManager::registerPrefab(const std::string& name, PrefabFactory factory) {
+    auto it = m_prefabIds.find(name);
+    if (it != m_prefabIds.end()) {
+        m_prefabs[it->second] = std::move(factory);
+        return it->second;
     }
     
-    // Call factory function to create entity
-    auto entity = it->second(position);
-    
-    // Add to entity list
-    if (entity) {
-        m_entities.push_back(entity);
+    PrefabId id = static_cast<PrefabId>(m_prefabs.size());
+    m_prefabs.push_back(std::move(factory));
+    m_prefabIds.emplace(name, id);
+    return id;
+}
+
+PrefabId EntityManager::findPrefab(const std::string& name) const {
+    auto it = m_prefabIds.find(name);
+    return it != m_prefabIds.end() ? it->second : kInvalidPrefab;
+}
+
+size_t EntityManager::spawnBatch(PrefabId prefab, size_t count, const Vector2* positions) {
+    return spawnBatch(prefab, count, positions, m_entities);
+}
+
+size_t EntityManager::spawnBatch(PrefabId prefab, size_t count, const Vector2* positions,
+                                 std::vector<std::shared_ptr<Entity>>& out) const {
+    size_t first = out.size();
+    if (prefab < 0 || prefab >= static_cast<PrefabId>(m_prefabs.size()) || count == 0) {
+        return first;
     }
     
-    return entity;
+    // Grow geometrically so a run of small batches stays amortised
+    if (out.capacity() < first + count) {
+        out.reserve(std::max(first + count, out.capacity() * 2));
+    }
+    m_prefabs[prefab](positions, count, out);
+    return first;
 }
 
 void EntityManager::updateAll(float deltaTime) {
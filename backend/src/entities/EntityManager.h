@@ -8,10 +8,21 @@
 #include <string>
 #include "../include/Entity.h"
 #include "../include/Vector2.h"
+#include "../memory/BlockPool.h"
+#include "../memory/FrameArena.h"
+#include "../physics/TransformStore.h"
 
 // Entity factory function type
 using EntityFactory = std::function<std::shared_ptr<Entity>(const Vector2&)>;
 
+// Prefab handle, resolved from a name once and then used by index
+using PrefabId = int;
+constexpr PrefabId kInvalidPrefab = -1;
+
+// Builds one entity per position and appends them to out
+using PrefabFactory = std::function<void(const Vector2* positions, size_t count,
+                                         std::vector<std::shared_ptr<Entity>>& out)>;
+
 // Manager class for all game entities
 class EntityManager {
 public:
@@ -37,6 +48,35 @@ public:
     // Create entity from registered type
     std::shared_ptr<Entity> createEntityByType(const std::string& typeName, const Vector2& position);
     
+    // Prefabs; registering an existing name replaces its factory and keeps its id
+    PrefabId registerPrefab(const std::string& name, PrefabFactory factory);
+    PrefabId findPrefab(const std::string& name) const;
+    
+    // Prefab factory constructing T(transforms, position, args...) per position.
+    // Each prefab's entities, with their shared_ptr control blocks, come from
+    // its own block pool: a batch reserves all its blocks with at most one
+    // chunk allocation, and blocks freed by dead entities are reused.
+    template<typename T, typename... Args>
+    static PrefabFactory makePrefab(TransformStore& transforms, Args... args) {
+        auto pool = std::make_shared<BlockPool>();
+        return [&transforms, pool, args...](const Vector2* positions, size_t count,
+                                            std::vector<std::shared_ptr<Entity>>& out) {
+            transforms.reserve(count);
+            pool->reserve(count);
+            PoolAllocator<T> allocator(pool);
+            for (size_t i = 0; i < count; ++i) {
+                out.push_back(std::allocate_shared<T>(allocator, transforms, positions[i], args...));
+            }
+        };
+    }
+    
+    // Creates count entities of one prefab, reserving once and making a
+    // single factory call. Returns the index of the first new entity in the
+    // managed list, or in out for callers that keep their own list.
+    size_t spawnBatch(PrefabId prefab, size_t count, const Vector2* positions);
+    size_t spawnBatch(PrefabId prefab, size_t count, const Vector2* positions,
+                      std::vector<std::shared_ptr<Entity>>& out) const;
+    
     // Get all entities
     const std::vector<std::shared_ptr<Entity>>& getAllEntities() const { return m_entities; }
     
@@ -53,16 +93,31 @@ public:
         return result;
     }
     
+    // Get entities by type into per-tick arena memory
+    template<typename T>
+    ArenaVector<T*> getEntitiesByType(FrameArena& arena) const {
+        ArenaVector<T*> result{ArenaAllocator<T*>(arena)};
+        result.reserve(m_entities.size());
+        for (const auto& entity : m_entities) {
+            T* typedEntity = dynamic_cast<T*>(entity.get());
+            if (typedEntity) {
+                result.push_back(typedEntity);
+            }
+        }
+        return result;
+    }
+    
     // Update all entities
     void updateAll(float deltaTime);
     
     // Clear all entities
     void clear();
-    
+
 private:
     // Entity list
     std::vector<std::shared_ptr<Entity>> m_entities;
     
-    // Entity factory map
-    std::unordered_map<std::string, EntityFactory> m_entityFactories;
+    // Prefab factories by id, and the ids by name
+    std::vector<PrefabFactory> m_prefabs;
+    std::unordered_map<std::string, PrefabId> m_prefabIds;
 };
\ No newline at end of file
@@ -1,41 +1,24 @@
 // backend/src/PowerUp.cpp
 #include "PowerUp.h"
+#include "../entities/Archetypes.h"
+#include "../replay/BinaryStream.h"
 
-PowerUp::PowerUp(const Vector2& position, PowerUpType type)
-    : Entity(EntityType::POWERUP, position, 10.0f),
+PowerUp::PowerUp(TransformStore& transforms, const Vector2& position, PowerUpType type)
+    : Entity(transforms, EntityType::POWERUP, position, getArchetype(type).radius),
       m_powerUpType(type),
-      m_lifetime(0.0f),
-      m_maxLifetime(10.0f), // Power-ups disappear after 10 seconds
       m_pulseTime(0.0f),
       m_growing(true) {
-    
-    // Set value based on power-up type
-    switch (m_powerUpType) {
-        case PowerUpType::HEALTH:
-            m_value = 25.0f; // Restore 25 health
-            break;
-        case PowerUpType::SPEED:
-            m_value = 1.5f; // 50% speed boost
-            break;
-        case PowerUpType::SHIELD:
-            m_value = 3.0f; // Shield for 3 seconds
-            break;
-        case PowerUpType::DAMAGE_BOOST:
-            m_value = 2.0f; // Double damage
-            break;
-    }
+}
+
+float PowerUp::getValue() const {
+    return getArchetype(m_powerUpType).value;
+}
+
+float PowerUp::getTimerDelay() const {
+    return getArchetype(m_powerUpType).lifetime;
 }
 
 void PowerUp::update(float deltaTime) {
-    // Update lifetime
-    m_lifetime += deltaTime;
-    
-    // Check if lifetime exceeded
-    if (m_lifetime >= m_maxLifetime) {
-        setActive(false);
-        return;
-    }
-    
     // Pulse animation (grow and shrink)
     m_pulseTime += deltaTime;
     
@@ -54,10 +37,35 @@ void PowerUp::update(float deltaTime) {
     // No movement for power-ups
 }
 
+float PowerUp::onTimer(const AIContext& /*context*/) {
+    // Lifetime is over
+    setActive(false);
+    return -1.0f;
+}
+
 void PowerUp::handleCollision(Entity* other) {
     // Only interact with player
     if (other->getType() == EntityType::PLAYER) {
         // Power-up is collected
         setActive(false);
     }
+}
+
+void PowerUp::saveState(BinaryWriter& writer) const {
+    Entity::saveState(writer);
+    writer.write(static_cast<uint8_t>(m_powerUpType));
+    writer.write(m_pulseTime);
+    writer.write(m_growing);
+}
+
+void PowerUp::loadState(BinaryReader& reader) {
+    Entity::loadState(reader);
+    uint8_t powerUpType = reader.read<uint8_t>();
+    if (powerUpType < kPowerUpTypeCount) {
+        m_powerUpType = static_cast<PowerUpType>(powerUpType);
+    } else {
+        reader.fail();
+    }
+    reader.read(m_pulseTime);
+    m_growing = reader.readBool();
 }
\ No newline at end of file
@@ -10,20 +10,27 @@ enum class PowerUpType {
     DAMAGE_BOOST
 };
 
-class PowerUp : public Entity {
+constexpr int kPowerUpTypeCount = 4;
+
+// Value, lifetime and starting size come from kPowerUpArchetypes
+class PowerUp final : public Entity {
 public:
-    PowerUp(const Vector2& position, PowerUpType type);
+    PowerUp(TransformStore& transforms, const Vector2& position, PowerUpType type);
     virtual void update(float deltaTime) override;
     virtual void handleCollision(Entity* other) override;
     
+    // Expires from the game's timing wheel
+    virtual float getTimerDelay() const override;
+    virtual float onTimer(const AIContext& context) override;
+    
     PowerUpType getPowerUpType() const { return m_powerUpType; }
-    float getValue() const { return m_value; }
+    float getValue() const;
     
+    virtual void saveState(BinaryWriter& writer) const override;
+    virtual void loadState(BinaryReader& reader) override;
+
 private:
     PowerUpType m_powerUpType;
-    float m_value;
-    float m_lifetime;
-    float m_maxLifetime;
     float m_pulseTime;
     bool m_growing;
 };
\ No newline at end of file
@@ -1,29 +1,28 @@
 // backend/src/Projectile.cpp
 #include "Projectile.h"
+#include "../entities/Archetypes.h"
+#include "../replay/BinaryStream.h"
 
-Projectile::Projectile(const Vector2& position, const Vector2& direction, float speed, ProjectileType type)
-    : Entity(EntityType::PROJECTILE, position, 5.0f),
+Projectile::Projectile(TransformStore& transforms, const Vector2& position, const Vector2& direction, float speed, ProjectileType type)
+    : Entity(transforms, EntityType::PROJECTILE, position, getArchetype(type).radius),
       m_projectileType(type),
-      m_lifetime(0.0f),
-      m_maxLifetime(2.0f),
       m_sourceId(-1) {
     
     // Set velocity based on direction and speed
-    m_velocity = direction.normalized() * speed;
+    setVelocity(direction.normalized() * speed);
+    
+    // Player shots only reach drones, enemy shots only the player
+    m_collisionFilter.mask = getArchetype(type).targets;
 }
 
-void Projectile::update(float deltaTime) {
-    // Update lifetime
-    m_lifetime += deltaTime;
-    
-    // Check if lifetime exceeded
-    if (m_lifetime >= m_maxLifetime) {
-        setActive(false);
-        return;
-    }
-    
-    // Call parent update to apply movement
-    Entity::update(deltaTime);
+float Projectile::getTimerDelay() const {
+    return getArchetype(m_projectileType).lifetime;
+}
+
+float Projectile::onTimer(const AIContext& /*context*/) {
+    // Lifetime is over
+    setActive(false);
+    return -1.0f;
 }
 
 void Projectile::handleCollision(Entity* other) {
@@ -44,4 +43,21 @@ void Projectile::handleCollision(Entity* other) {
             setActive(false);
         }
     }
+}
+
+void Projectile::saveState(BinaryWriter& writer) const {
+    Entity::saveState(writer);
+    writer.write(static_cast<uint8_t>(m_projectileType));
+    writer.write(m_sourceId);
+}
+
+void Projectile::loadState(BinaryReader& reader) {
+    Entity::loadState(reader);
+    uint8_t projectileType = reader.read<uint8_t>();
+    if (projectileType < kProjectileTypeCount) {
+        m_projectileType = static_cast<ProjectileType>(projectileType);
+    } else {
+        reader.fail();
+    }
+    reader.read(m_sourceId);
 }
\ No newline at end of file
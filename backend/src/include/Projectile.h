@@ -8,19 +8,29 @@ enum class ProjectileType {
     ENEMY
 };
 
-class Projectile : public Entity {
+constexpr int kProjectileTypeCount = 2;
+
+// Lifetime and size come from kProjectileArchetypes
+class Projectile final : public Entity {
 public:
-    Projectile(const Vector2& position, const Vector2& direction, float speed, ProjectileType type);
-    virtual void update(float deltaTime) override;
+    Projectile(TransformStore& transforms, const Vector2& position, const Vector2& direction, float speed, ProjectileType type);
     virtual void handleCollision(Entity* other) override;
     
+    // Expires from the game's timing wheel
+    virtual float getTimerDelay() const override;
+    virtual float onTimer(const AIContext& context) override;
+    
     ProjectileType getProjectileType() const { return m_projectileType; }
     int getSourceId() const { return m_sourceId; }
-    void setSourceId(int id) { m_sourceId = id; }
+    void setSourceId(int id) {
+        m_sourceId = id;
+        m_collisionFilter.ignoreId = id;
+    }
     
+    virtual void saveState(BinaryWriter& writer) const override;
+    virtual void loadState(BinaryReader& reader) override;
+
 private:
     ProjectileType m_projectileType;
-    float m_lifetime;
-    float m_maxLifetime;
     int m_sourceId; // ID of the entity that created this projectile
 };
\ No newline at end of file
@@ -0,0 +1,30 @@
+// backend/src/memory/AllocationTracker.h
+#pragma once
+
+#include <cstdint>
+
+// Global operator new is replaced to count heap allocations unless
+// DODGEBALL_TRACK_ALLOCATIONS is defined to 0
+#ifndef DODGEBALL_TRACK_ALLOCATIONS
+#define DODGEBALL_TRACK_ALLOCATIONS 1
+#endif
+
+namespace AllocationTracker {
+
+// Running totals since program start
+struct Snapshot {
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+};
+
+Snapshot snapshot();
+
+// Difference between two snapshots
+inline Snapshot since(const Snapshot& earlier, const Snapshot& later) {
+    Snapshot delta;
+    delta.allocations = later.allocations - earlier.allocations;
+    delta.bytes = later.bytes - earlier.bytes;
+    return delta;
+}
+
+} // namespace AllocationTracker
@@ -0,0 +1,73 @@
+// backend/src/memory/BlockPool.cpp
+#include "BlockPool.h"
+#include <algorithm>
+#include <new>
+
+namespace {
+size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+}
+
+BlockPool::BlockPool(size_t blocksPerChunk)
+    : m_blockSize(0),
+      m_blocksPerChunk(std::max<size_t>(blocksPerChunk, 1)),
+      m_pendingReserve(0),
+      m_free(nullptr),
+      m_freeCount(0) {
+}
+
+BlockPool::~BlockPool() {
+    for (void* chunk : m_chunks) {
+        ::operator delete(chunk);
+    }
+}
+
+void* BlockPool::allocate(size_t size) {
+    if (m_blockSize == 0) {
+        // Every block is max_align_t aligned and can hold a free-list link
+        m_blockSize = alignUp(std::max(size, sizeof(FreeBlock)), alignof(std::max_align_t));
+        reserve(m_pendingReserve);
+    }
+    
+    if (!m_free) {
+        grow(m_blocksPerChunk);
+    }
+    
+    FreeBlock* block = m_free;
+    m_free = block->next;
+    m_freeCount--;
+    return block;
+}
+
+void BlockPool::deallocate(void* block) {
+    FreeBlock* freed = static_cast<FreeBlock*>(block);
+    freed->next = m_free;
+    m_free = freed;
+    m_freeCount++;
+}
+
+void BlockPool::reserve(size_t blocks) {
+    // The size is not known until the first allocation; remember the request
+    if (m_blockSize == 0) {
+        m_pendingReserve = std::max(m_pendingReserve, blocks);
+        return;
+    }
+    
+    if (m_freeCount < blocks) {
+        grow(std::max(blocks - m_freeCount, m_blocksPerChunk));
+    }
+}
+
+void BlockPool::grow(size_t blocks) {
+    unsigned char* chunk = static_cast<unsigned char*>(::operator new(blocks * m_blockSize));
+    m_chunks.push_back(chunk);
+    
+    // Thread the new blocks onto the free list in address order
+    for (size_t i = blocks; i > 0; --i) {
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk + (i - 1) * m_blockSize);
+        block->next = m_free;
+        m_free = block;
+    }
+    m_freeCount += blocks;
+}
@@ -0,0 +1,96 @@
+// backend/src/memory/BlockPool.h
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Free list of equal-sized blocks carved out of chunks that are allocated
+// in bulk. The first allocation fixes the block size; larger requests are
+// refused so the caller can use the heap instead. Freed blocks are reused
+// and chunks are only returned when the pool is destroyed. Not
+// thread-safe: a pool belongs to one game and that game's thread.
+class BlockPool {
+public:
+    explicit BlockPool(size_t blocksPerChunk = 64);
+    ~BlockPool();
+    
+    BlockPool(const BlockPool&) = delete;
+    BlockPool& operator=(const BlockPool&) = delete;
+    
+    // Whether allocate(size) is served from the pool; stays the same for a
+    // given size once the first block has been handed out
+    bool accepts(size_t size) const { return m_blockSize == 0 || size <= m_blockSize; }
+    
+    void* allocate(size_t size);
+    void deallocate(void* block);
+    
+    // Room for this many more blocks, allocating at most one chunk
+    void reserve(size_t blocks);
+    
+    size_t getBlockSize() const { return m_blockSize; }
+    size_t getFreeCount() const { return m_freeCount; }
+    size_t getChunkCount() const { return m_chunks.size(); }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+    
+    size_t m_blockSize;
+    size_t m_blocksPerChunk;
+    size_t m_pendingReserve;
+    FreeBlock* m_free;
+    size_t m_freeCount;
+    std::vector<void*> m_chunks;
+    
+    void grow(size_t blocks);
+};
+
+// STL allocator adapter for single objects, such as allocate_shared()
+// control blocks. Arrays and over-aligned types go to the heap. Every
+// copy shares ownership of the pool, so blocks can outlive whoever made it.
+template<typename T>
+class PoolAllocator {
+public:
+    using value_type = T;
+    
+    explicit PoolAllocator(std::shared_ptr<BlockPool> pool) : m_pool(std::move(pool)) {}
+    
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U>& other) : m_pool(other.getPool()) {}
+    
+    T* allocate(size_t count) {
+        if (usesPool(count)) {
+            return static_cast<T*>(m_pool->allocate(sizeof(T)));
+        }
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+    
+    void deallocate(T* pointer, size_t count) {
+        if (usesPool(count)) {
+            m_pool->deallocate(pointer);
+        } else {
+            ::operator delete(pointer);
+        }
+    }
+    
+    const std::shared_ptr<BlockPool>& getPool() const { return m_pool; }
+
+private:
+    std::shared_ptr<BlockPool> m_pool;
+    
+    bool usesPool(size_t count) const {
+        return count == 1 && alignof(T) <= alignof(std::max_align_t) && m_pool->accepts(sizeof(T));
+    }
+};
+
+template<typename T, typename U>
+bool operator==(const PoolAllocator<T>& a, const PoolAllocator<U>& b) {
+    return a.getPool() == b.getPool();
+}
+
+template<typename T, typename U>
+bool operator!=(const PoolAllocator<T>& a, const PoolAllocator<U>& b) {
+    return a.getPool() != b.getPool();
+}
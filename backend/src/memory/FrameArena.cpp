@@ -0,0 +1,66 @@
+// backend/src/memory/FrameArena.cpp
+#include "FrameArena.h"
+#include <algorithm>
+#include <new>
+
+namespace {
+size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+}
+
+FrameArena::FrameArena(size_t capacity)
+    : m_block(static_cast<unsigned char*>(::operator new(capacity))),
+      m_capacity(capacity),
+      m_offset(0),
+      m_overflowBytes(0),
+      m_highWaterMark(0),
+      m_overflowFrames(0) {
+    m_overflowBlocks.reserve(16);
+}
+
+FrameArena::~FrameArena() {
+    for (unsigned char* block : m_overflowBlocks) {
+        ::operator delete(block);
+    }
+    ::operator delete(m_block);
+}
+
+void* FrameArena::allocate(size_t size, size_t alignment) {
+    // The main block is max_align_t aligned, so aligning the offset is enough
+    size_t start = alignUp(m_offset, alignment);
+    if (start + size <= m_capacity) {
+        m_offset = start + size;
+        return m_block + start;
+    }
+    
+    // Overflow: serve from a dedicated heap block until the next reset
+    unsigned char* block = static_cast<unsigned char*>(::operator new(size + alignment));
+    m_overflowBlocks.push_back(block);
+    m_overflowBytes += size;
+    
+    size_t address = reinterpret_cast<size_t>(block);
+    return block + (alignUp(address, alignment) - address);
+}
+
+void FrameArena::reset() {
+    size_t used = getUsed();
+    m_highWaterMark = std::max(m_highWaterMark, used);
+    
+    if (!m_overflowBlocks.empty()) {
+        for (unsigned char* block : m_overflowBlocks) {
+            ::operator delete(block);
+        }
+        m_overflowBlocks.clear();
+        m_overflowFrames++;
+        
+        // Grow so a frame like this one fits in the main block next time
+        size_t newCapacity = std::max(m_capacity * 2, alignUp(m_highWaterMark + m_highWaterMark / 4, 4096));
+        ::operator delete(m_block);
+        m_block = static_cast<unsigned char*>(::operator new(newCapacity));
+        m_capacity = newCapacity;
+    }
+    
+    m_offset = 0;
+    m_overflowBytes = 0;
+}
@@ -0,0 +1,85 @@
+// backend/src/memory/FrameArena.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Linear allocator for data that only lives until the end of the tick.
+// Allocation bumps an offset; nothing is freed individually and reset()
+// releases everything at once. If a frame outgrows the block, overflow
+// blocks come from the heap and the main block is enlarged on the next
+// reset, so steady-state frames never touch the global heap.
+class FrameArena {
+public:
+    explicit FrameArena(size_t capacity = 256 * 1024);
+    ~FrameArena();
+    
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+    
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+    
+    // Release every allocation made since the previous reset
+    void reset();
+    
+    // Bytes handed out since the last reset
+    size_t getUsed() const { return m_offset + m_overflowBytes; }
+    size_t getCapacity() const { return m_capacity; }
+    
+    // Largest getUsed() seen at any reset
+    size_t getHighWaterMark() const { return m_highWaterMark; }
+    
+    // Frames that had to fall back to overflow blocks
+    uint32_t getOverflowFrames() const { return m_overflowFrames; }
+    
+private:
+    unsigned char* m_block;
+    size_t m_capacity;
+    size_t m_offset;
+    
+    std::vector<unsigned char*> m_overflowBlocks;
+    size_t m_overflowBytes;
+    
+    size_t m_highWaterMark;
+    uint32_t m_overflowFrames;
+};
+
+// STL allocator adapter; deallocation is a no-op until the arena resets
+template<typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+    
+    ArenaAllocator(FrameArena& arena) : m_arena(&arena) {}
+    
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : m_arena(other.getArena()) {}
+    
+    T* allocate(size_t count) {
+        return static_cast<T*>(m_arena->allocate(count * sizeof(T), alignof(T)));
+    }
+    
+    void deallocate(T*, size_t) {
+    }
+    
+    FrameArena* getArena() const { return m_arena; }
+    
+private:
+    FrameArena* m_arena;
+};
+
+template<typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.getArena() == b.getArena();
+}
+
+template<typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.getArena() != b.getArena();
+}
+
+// Vector whose storage lives in a frame arena; reserve() up front where
+// possible since growth leaves the old buffer behind until reset
+template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
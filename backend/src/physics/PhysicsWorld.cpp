@@ -1,175 +1,452 @@
 // backend/src/physics/PhysicsWorld.cpp
 #include "PhysicsWorld.h"
 #include "../include/Entity.h"
+#include "../profiling/Profiler.h"
+#include <algorithm>
+#include <cmath>
 
-// Contact listener implementation
-PhysicsWorld::ContactListener::ContactListener(PhysicsWorld* physicsWorld)
-    : m_physicsWorld(physicsWorld) {
-}
+namespace {
+const float kPi = 3.14159265f;
 
-void PhysicsWorld::ContactListener::BeginContact(b2Contact* contact) {
-    // Get the entities from the fixtures' user data
-    b2Body* bodyA = contact->GetFixtureA()->GetBody();
-    b2Body* bodyB = contact->GetFixtureB()->GetBody();
-    
-    auto itA = m_physicsWorld->m_bodyEntityMap.find(bodyA);
-    auto itB = m_physicsWorld->m_bodyEntityMap.find(bodyB);
-    
-    if (itA != m_physicsWorld->m_bodyEntityMap.end() && itB != m_physicsWorld->m_bodyEntityMap.end()) {
-        Entity* entityA = itA->second;
-        Entity* entityB = itB->second;
-        
-        // Notify entities of collision
-        if (entityA && entityB) {
-            entityA->handleCollision(entityB);
-            entityB->handleCollision(entityA);
-        }
-    }
-}
+// Solver tolerances, in world units (pixels)
+const float kLinearSlop = 0.5f;            // Overlap left alone to keep contacts stable
+const float kMaxCorrection = 8.0f;         // Largest push apart per position iteration
+const float kBaumgarte = 0.2f;             // Fraction of the overlap removed per iteration
+const float kVelocityThreshold = 10.0f;    // Closing speed below which nothing bounces
+
+// Below this many contacts a step is cheaper to solve on one thread
+const size_t kParallelMinContacts = 64;
 
-void PhysicsWorld::ContactListener::EndContact(b2Contact* contact) {
-    // Handle end of contact if needed
+float dot(const Vector2& a, const Vector2& b) {
+    return a.x * b.x + a.y * b.y;
+}
 }
 
-// PhysicsWorld implementation
 PhysicsWorld::PhysicsWorld(float gravity)
-    : m_world(std::make_unique<b2World>(b2Vec2(0.0f, gravity))),
-      m_timeStep(1.0f / 60.0f),
+    : m_transforms(nullptr),
+      m_gravity(0.0f, gravity),
       m_velocityIterations(8),
-      m_positionIterations(3) {
-    
-    // Set up contact listener
-    m_contactListener = std::make_unique<ContactListener>(this);
-    m_world->SetContactListener(m_contactListener.get());
+      m_positionIterations(3),
+      m_velocityTolerance(0.0f),
+      m_warmStarting(true),
+      m_workerCount(ThreadPool::defaultWorkerCount()) {
 }
 
-PhysicsWorld::~PhysicsWorld() {
-    // Clean up all bodies
-    b2Body* body = m_world->GetBodyList();
-    while (body) {
-        b2Body* nextBody = body->GetNext();
-        m_world->DestroyBody(body);
-        body = nextBody;
+void PhysicsWorld::setWorkerCount(int count) {
+    count = std::max(0, count);
+    if (count != m_workerCount) {
+        m_workerCount = count;
+        m_threadPool.reset();
     }
 }
 
+uint64_t PhysicsWorld::makeKey(int a, int b) {
+    uint32_t low = static_cast<uint32_t>(std::min(a, b));
+    uint32_t high = static_cast<uint32_t>(std::max(a, b));
+    return (static_cast<uint64_t>(low) << 32) | high;
+}
+
+void PhysicsWorld::setTransforms(TransformStore* transforms) {
+    if (transforms != m_transforms) {
+        m_bodies.clear();
+        m_freeBodies.clear();
+        m_contacts.clear();
+        m_previousContacts.clear();
+    }
+    m_transforms = transforms;
+}
+
 void PhysicsWorld::update(float deltaTime) {
-    // Step the simulation
-    m_world->Step(m_timeStep, m_velocityIterations, m_positionIterations);
+    PROFILE_ZONE("PhysicsWorld::update");
+    
+    m_stats = PhysicsStats();
+    if (!m_transforms) {
+        return;
+    }
     
-    // Update entity positions from physics bodies
-    for (auto& pair : m_bodyEntityMap) {
-        b2Body* body = pair.first;
-        Entity* entity = pair.second;
+    // Velocities only; positions are integrated with everything else
+    for (Body& body : m_bodies) {
+        if (!body.entity || !body.dynamic) {
+            continue;
+        }
         
-        if (body && entity) {
-            updateEntityFromBody(entity, body);
+        Vector2 velocity = m_transforms->getVelocity(body.transform);
+        velocity = velocity + (m_gravity + body.force * body.inverseMass) * deltaTime;
+        velocity = velocity * (1.0f / (1.0f + deltaTime * body.linearDamping));
+        m_transforms->setVelocity(body.transform, velocity);
+        body.force = Vector2(0.0f, 0.0f);
+    }
+    
+    findContacts();
+    buildIslands();
+    
+    // Islands share no dynamic body, so any thread may take any island
+    bool parallel = m_workerCount > 0 && m_islands.size() > 1 && m_contacts.size() >= kParallelMinContacts;
+    if (parallel) {
+        if (!m_threadPool) {
+            m_threadPool = std::make_unique<ThreadPool>(m_workerCount);
         }
+        m_threadPool->parallelFor(static_cast<int>(m_islands.size()), [this](int index) {
+            solveIsland(m_islands[index]);
+        });
+    } else {
+        for (Island& island : m_islands) {
+            solveIsland(island);
+        }
+    }
+    
+    m_stats.parallel = parallel;
+    m_stats.islands = static_cast<int>(m_islands.size());
+    float minSeparation = 0.0f;
+    for (const Island& island : m_islands) {
+        m_stats.largestIsland = std::max(m_stats.largestIsland, island.contactCount);
+        m_stats.velocityIterations = std::max(m_stats.velocityIterations, island.velocityIterations);
+        m_stats.positionIterations = std::max(m_stats.positionIterations, island.positionIterations);
+        m_stats.residual = std::max(m_stats.residual, island.residual);
+        minSeparation = std::min(minSeparation, island.minSeparation);
     }
+    m_stats.maxPenetration = -minSeparation;
 }
 
-void PhysicsWorld::setGravity(float gravity) {
-    m_world->SetGravity(b2Vec2(0.0f, gravity));
+void PhysicsWorld::solveIsland(Island& island) {
+    const int* contacts = m_islandContacts.data() + island.firstContact;
+    prepareContacts(contacts, island.contactCount);
+    
+    for (int i = 0; i < m_velocityIterations; ++i) {
+        island.residual = solveVelocities(contacts, island.contactCount);
+        island.velocityIterations++;
+        if (island.residual <= m_velocityTolerance) {
+            break;
+        }
+    }
+    
+    // Push overlapping bodies apart directly; this corrects positions, it
+    // does not advance them
+    for (int i = 0; i < m_positionIterations; ++i) {
+        island.minSeparation = solvePositions(contacts, island.contactCount);
+        island.positionIterations++;
+        if (island.minSeparation >= -3.0f * kLinearSlop) {
+            break;
+        }
+    }
 }
 
-b2Body* PhysicsWorld::createBody(Entity* entity, bool isDynamic) {
-    if (!entity) {
-        return nullptr;
+int PhysicsWorld::findRoot(int body) {
+    while (m_islandParent[body] != body) {
+        m_islandParent[body] = m_islandParent[m_islandParent[body]];
+        body = m_islandParent[body];
+    }
+    return body;
+}
+
+void PhysicsWorld::buildIslands() {
+    m_islandParent.resize(m_bodies.size());
+    for (size_t i = 0; i < m_islandParent.size(); ++i) {
+        m_islandParent[i] = static_cast<int>(i);
     }
     
-    // Create body definition
-    b2BodyDef bodyDef;
-    bodyDef.type = isDynamic ? b2_dynamicBody : b2_staticBody;
-    bodyDef.position.Set(entity->getPosition().x, entity->getPosition().y);
-    bodyDef.linearDamping = 0.5f;
-    bodyDef.angularDamping = 0.5f;
+    // Join the dynamic bodies of every contact; the lower root wins so the
+    // grouping does not depend on anything but the contacts
+    for (const Contact& contact : m_contacts) {
+        if (m_bodies[contact.a].dynamic && m_bodies[contact.b].dynamic) {
+            int rootA = findRoot(contact.a);
+            int rootB = findRoot(contact.b);
+            m_islandParent[std::max(rootA, rootB)] = std::min(rootA, rootB);
+        }
+    }
     
-    // Create body
-    b2Body* body = m_world->CreateBody(&bodyDef);
+    // Number the islands in order of their first contact
+    m_islands.clear();
+    m_islandOfRoot.assign(m_bodies.size(), -1);
+    m_contactIsland.resize(m_contacts.size());
+    for (size_t i = 0; i < m_contacts.size(); ++i) {
+        const Contact& contact = m_contacts[i];
+        int root = findRoot(m_bodies[contact.a].dynamic ? contact.a : contact.b);
+        if (m_islandOfRoot[root] < 0) {
+            m_islandOfRoot[root] = static_cast<int>(m_islands.size());
+            m_islands.push_back({0, 0, 0, 0, 0.0f, 0.0f});
+        }
+        m_contactIsland[i] = m_islandOfRoot[root];
+        m_islands[m_contactIsland[i]].contactCount++;
+    }
     
-    // Create circular fixture for the body
-    b2CircleShape circleShape;
-    circleShape.m_radius = entity->getRadius();
+    // Group the contact indices by island, keeping their order within each
+    int first = 0;
+    for (Island& island : m_islands) {
+        island.firstContact = first;
+        first += island.contactCount;
+        island.contactCount = 0;
+    }
+    m_islandContacts.resize(m_contacts.size());
+    for (size_t i = 0; i < m_contacts.size(); ++i) {
+        Island& island = m_islands[m_contactIsland[i]];
+        m_islandContacts[island.firstContact + island.contactCount++] = static_cast<int>(i);
+    }
+}
+
+void PhysicsWorld::setIterations(int velocityIterations, int positionIterations) {
+    m_velocityIterations = std::max(0, velocityIterations);
+    m_positionIterations = std::max(0, positionIterations);
+}
+
+void PhysicsWorld::findContacts() {
+    // Last step's contacts are kept for warm starting
+    m_previousContacts.swap(m_contacts);
+    m_contacts.clear();
     
-    b2FixtureDef fixtureDef;
-    fixtureDef.shape = &circleShape;
-    fixtureDef.density = 1.0f;
-    fixtureDef.friction = 0.3f;
-    fixtureDef.restitution = 0.5f; // Bouncy
+    m_sweep.clear();
+    for (size_t i = 0; i < m_bodies.size(); ++i) {
+        Body& body = m_bodies[i];
+        if (body.entity) {
+            body.radius = body.entity->getRadius();
+            m_sweep.push_back(static_cast<int>(i));
+        }
+    }
+    m_stats.bodies = static_cast<int>(m_sweep.size());
     
-    body->CreateFixture(&fixtureDef);
+    // Sort and sweep along x; ties go by handle so the order is repeatable
+    auto minX = [this](int handle) {
+        return m_transforms->getPosition(m_bodies[handle].transform).x - m_bodies[handle].radius;
+    };
+    std::sort(m_sweep.begin(), m_sweep.end(), [&](int a, int b) {
+        float ax = minX(a);
+        float bx = minX(b);
+        return ax < bx || (ax == bx && a < b);
+    });
     
-    // Store entity reference
-    m_bodyEntityMap[body] = entity;
+    for (size_t i = 0; i < m_sweep.size(); ++i) {
+        const Body& first = m_bodies[m_sweep[i]];
+        Vector2 firstPosition = m_transforms->getPosition(first.transform);
+        float maxX = firstPosition.x + first.radius;
+        
+        for (size_t j = i + 1; j < m_sweep.size() && minX(m_sweep[j]) <= maxX; ++j) {
+            const Body& second = m_bodies[m_sweep[j]];
+            if (!first.dynamic && !second.dynamic) {
+                continue;
+            }
+            
+            Vector2 delta = m_transforms->getPosition(second.transform) - firstPosition;
+            float radii = first.radius + second.radius;
+            if (delta.lengthSquared() >= radii * radii) {
+                continue;
+            }
+            
+            Contact contact;
+            contact.a = std::min(m_sweep[i], m_sweep[j]);
+            contact.b = std::max(m_sweep[i], m_sweep[j]);
+            contact.key = makeKey(contact.a, contact.b);
+            contact.normalImpulse = 0.0f;
+            contact.tangentImpulse = 0.0f;
+            m_contacts.push_back(contact);
+        }
+    }
+    std::sort(m_contacts.begin(), m_contacts.end(),
+              [](const Contact& a, const Contact& b) { return a.key < b.key; });
+    m_stats.contacts = static_cast<int>(m_contacts.size());
     
-    return body;
+    // Carry over the impulses of pairs that were already touching
+    if (!m_warmStarting) {
+        return;
+    }
+    size_t previous = 0;
+    for (Contact& contact : m_contacts) {
+        while (previous < m_previousContacts.size() && m_previousContacts[previous].key < contact.key) {
+            previous++;
+        }
+        if (previous < m_previousContacts.size() && m_previousContacts[previous].key == contact.key) {
+            contact.normalImpulse = m_previousContacts[previous].normalImpulse;
+            contact.tangentImpulse = m_previousContacts[previous].tangentImpulse;
+            m_stats.warmStarted++;
+        }
+    }
+}
+
+void PhysicsWorld::prepareContacts(const int* contacts, int count) {
+    for (int i = 0; i < count; ++i) {
+        Contact& contact = m_contacts[contacts[i]];
+        const Body& a = m_bodies[contact.a];
+        const Body& b = m_bodies[contact.b];
+        
+        Vector2 delta = m_transforms->getPosition(b.transform) - m_transforms->getPosition(a.transform);
+        float distance = delta.length();
+        contact.normal = distance > 0.0f ? delta / distance : Vector2(1.0f, 0.0f);
+        contact.separation = distance - a.radius - b.radius;
+        
+        float inverseMassSum = a.inverseMass + b.inverseMass;
+        contact.normalMass = inverseMassSum > 0.0f ? 1.0f / inverseMassSum : 0.0f;
+        contact.friction = std::sqrt(a.friction * b.friction);
+        
+        // Bounce only off contacts that are closing fast enough
+        Vector2 velocityA = m_transforms->getVelocity(a.transform);
+        Vector2 velocityB = m_transforms->getVelocity(b.transform);
+        float closing = dot(velocityB - velocityA, contact.normal);
+        float restitution = std::max(a.restitution, b.restitution);
+        contact.velocityBias = closing < -kVelocityThreshold ? -restitution * closing : 0.0f;
+        
+        // Warm start: reapply last step's impulses before iterating
+        Vector2 tangent(-contact.normal.y, contact.normal.x);
+        Vector2 impulse = contact.normal * contact.normalImpulse + tangent * contact.tangentImpulse;
+        // Static bodies may be touched by several islands at once; only
+        // dynamic ones, which belong to this island, are written
+        if (a.dynamic) {
+            m_transforms->setVelocity(a.transform, velocityA - impulse * a.inverseMass);
+        }
+        if (b.dynamic) {
+            m_transforms->setVelocity(b.transform, velocityB + impulse * b.inverseMass);
+        }
+    }
 }
 
-void PhysicsWorld::removeBody(b2Body* body) {
-    if (body) {
-        // Remove from map
-        m_bodyEntityMap.erase(body);
+float PhysicsWorld::solveVelocities(const int* contacts, int count) {
+    float residual = 0.0f;
+    for (int i = 0; i < count; ++i) {
+        Contact& contact = m_contacts[contacts[i]];
+        const Body& a = m_bodies[contact.a];
+        const Body& b = m_bodies[contact.b];
+        Vector2 velocityA = m_transforms->getVelocity(a.transform);
+        Vector2 velocityB = m_transforms->getVelocity(b.transform);
+        
+        // Friction, bounded by the current normal impulse. Circles carry no
+        // spin, so the tangent and normal effective masses are the same.
+        Vector2 tangent(-contact.normal.y, contact.normal.x);
+        float lambda = -dot(velocityB - velocityA, tangent) * contact.normalMass;
+        float maxFriction = contact.friction * contact.normalImpulse;
+        float accumulated = std::max(-maxFriction, std::min(contact.tangentImpulse + lambda, maxFriction));
+        lambda = accumulated - contact.tangentImpulse;
+        contact.tangentImpulse = accumulated;
+        residual = std::max(residual, std::fabs(lambda));
+        velocityA = velocityA - tangent * (lambda * a.inverseMass);
+        velocityB = velocityB + tangent * (lambda * b.inverseMass);
+        
+        // Non-penetration; the accumulated impulse may only push
+        lambda = -(dot(velocityB - velocityA, contact.normal) - contact.velocityBias) * contact.normalMass;
+        accumulated = std::max(contact.normalImpulse + lambda, 0.0f);
+        lambda = accumulated - contact.normalImpulse;
+        contact.normalImpulse = accumulated;
+        residual = std::max(residual, std::fabs(lambda));
+        velocityA = velocityA - contact.normal * (lambda * a.inverseMass);
+        velocityB = velocityB + contact.normal * (lambda * b.inverseMass);
         
-        // Destroy body
-        m_world->DestroyBody(body);
+        if (a.dynamic) {
+            m_transforms->setVelocity(a.transform, velocityA);
+        }
+        if (b.dynamic) {
+            m_transforms->setVelocity(b.transform, velocityB);
+        }
     }
+    return residual;
 }
 
-void PhysicsWorld::updateEntityFromBody(Entity* entity, b2Body* body) {
-    if (entity && body) {
-        // Update entity position from body
-        b2Vec2 position = body->GetPosition();
-        entity->setPosition(Vector2(position.x, position.y));
+float PhysicsWorld::solvePositions(const int* contacts, int count) {
+    float minSeparation = 0.0f;
+    for (int i = 0; i < count; ++i) {
+        const Contact& contact = m_contacts[contacts[i]];
+        const Body& a = m_bodies[contact.a];
+        const Body& b = m_bodies[contact.b];
+        Vector2 positionA = m_transforms->getPosition(a.transform);
+        Vector2 positionB = m_transforms->getPosition(b.transform);
+        
+        // Separation at the current, partly corrected positions
+        Vector2 delta = positionB - positionA;
+        float distance = delta.length();
+        Vector2 normal = distance > 0.0f ? delta / distance : contact.normal;
+        float separation = distance - a.radius - b.radius;
+        minSeparation = std::min(minSeparation, separation);
         
-        // Update velocity
-        b2Vec2 velocity = body->GetLinearVelocity();
-        entity->setVelocity(Vector2(velocity.x, velocity.y));
+        float correction = std::max(-kMaxCorrection, std::min(kBaumgarte * (separation + kLinearSlop), 0.0f));
+        float impulse = -correction * contact.normalMass;
+        if (a.dynamic) {
+            m_transforms->setPosition(a.transform, positionA - normal * (impulse * a.inverseMass));
+        }
+        if (b.dynamic) {
+            m_transforms->setPosition(b.transform, positionB + normal * (impulse * b.inverseMass));
+        }
     }
+    return minSeparation;
+}
+
+void PhysicsWorld::setGravity(float gravity) {
+    m_gravity = Vector2(0.0f, gravity);
 }
 
-Vector2 PhysicsWorld::getBodyPosition(b2Body* body) const {
-    if (body) {
-        b2Vec2 position = body->GetPosition();
-        return Vector2(position.x, position.y);
+int PhysicsWorld::createBody(Entity* entity, bool isDynamic, const BodyMaterial& material) {
+    if (!entity || !m_transforms) {
+        return -1;
     }
-    return Vector2();
+    
+    int handle;
+    if (!m_freeBodies.empty()) {
+        handle = m_freeBodies.back();
+        m_freeBodies.pop_back();
+    } else {
+        handle = static_cast<int>(m_bodies.size());
+        m_bodies.emplace_back();
+    }
+    
+    float radius = entity->getRadius();
+    float mass = material.density * kPi * radius * radius;
+    
+    Body& body = m_bodies[handle];
+    body.entity = entity;
+    body.transform = entity->getTransformSlot();
+    body.dynamic = isDynamic;
+    body.inverseMass = isDynamic && mass > 0.0f ? 1.0f / mass : 0.0f;
+    body.friction = material.friction;
+    body.restitution = material.restitution;
+    body.linearDamping = material.linearDamping;
+    body.radius = radius;
+    body.force = Vector2(0.0f, 0.0f);
+    return handle;
 }
 
-void PhysicsWorld::setBodyPosition(b2Body* body, const Vector2& position) {
-    if (body) {
-        body->SetTransform(b2Vec2(position.x, position.y), body->GetAngle());
+void PhysicsWorld::removeBody(int body) {
+    if (body >= 0) {
+        m_bodies[body].entity = nullptr;
+        m_freeBodies.push_back(body);
+        
+        // The handle may be reused; its impulses must not warm start a new pair
+        m_contacts.erase(std::remove_if(m_contacts.begin(), m_contacts.end(),
+                                        [body](const Contact& contact) { return contact.a == body || contact.b == body; }),
+                         m_contacts.end());
     }
 }
 
-Vector2 PhysicsWorld::getBodyVelocity(b2Body* body) const {
-    if (body) {
-        b2Vec2 velocity = body->GetLinearVelocity();
-        return Vector2(velocity.x, velocity.y);
+Vector2 PhysicsWorld::getBodyPosition(int body) const {
+    if (body >= 0) {
+        return m_transforms->getPosition(m_bodies[body].transform);
     }
     return Vector2();
 }
 
-void PhysicsWorld::setBodyVelocity(b2Body* body, const Vector2& velocity) {
-    if (body) {
-        body->SetLinearVelocity(b2Vec2(velocity.x, velocity.y));
+void PhysicsWorld::setBodyPosition(int body, const Vector2& position) {
+    if (body >= 0) {
+        m_transforms->setPosition(m_bodies[body].transform, position);
     }
 }
 
-float PhysicsWorld::getBodyAngle(b2Body* body) const {
-    if (body) {
-        return body->GetAngle();
+Vector2 PhysicsWorld::getBodyVelocity(int body) const {
+    if (body >= 0) {
+        return m_transforms->getVelocity(m_bodies[body].transform);
+    }
+    return Vector2();
+}
+
+void PhysicsWorld::setBodyVelocity(int body, const Vector2& velocity) {
+    if (body >= 0) {
+        m_transforms->setVelocity(m_bodies[body].transform, velocity);
     }
-    return 0.0f;
 }
 
-void PhysicsWorld::applyForce(b2Body* body, const Vector2& force) {
-    if (body) {
-        body->ApplyForceToCenter(b2Vec2(force.x, force.y), true);
+void PhysicsWorld::applyForce(int body, const Vector2& force) {
+    if (body >= 0) {
+        m_bodies[body].force = m_bodies[body].force + force;
     }
 }
 
-void PhysicsWorld::applyImpulse(b2Body* body, const Vector2& impulse) {
-    if (body) {
-        body->ApplyLinearImpulseToCenter(b2Vec2(impulse.x, impulse.y), true);
+void PhysicsWorld::applyImpulse(int body, const Vector2& impulse) {
+    if (body >= 0) {
+        Body& target = m_bodies[body];
+        Vector2 velocity = m_transforms->getVelocity(target.transform);
+        m_transforms->setVelocity(target.transform, velocity + impulse * target.inverseMass);
     }
 }
\ No newline at end of file
@@ -1,52 +1,164 @@
 // backend/src/physics/PhysicsWorld.h
 #pragma once
 
-#include <box2d/box2d.h>
+#include <vector>
 #include <memory>
-#include <unordered_map>
+#include <cstdint>
+#include "TransformStore.h"
+#include "../concurrency/ThreadPool.h"
 #include "../include/Vector2.h"
 
 class Entity;
 
+// Surface and mass properties of a circle body
+struct BodyMaterial {
+    float density = 1.0f;
+    float friction = 0.3f;
+    float restitution = 0.5f;    // Bounciness
+    float linearDamping = 0.5f;
+};
+
+// Solver figures for the last update(), for trading cost against quality
+struct PhysicsStats {
+    int bodies = 0;
+    int contacts = 0;
+    int warmStarted = 0;           // Contacts that began from last step's impulses
+    int islands = 0;               // Groups of bodies connected by contacts
+    int largestIsland = 0;         // Contacts in the biggest one
+    bool parallel = false;         // Islands were spread over the thread pool
+    
+    // Worst case over the islands
+    int velocityIterations = 0;    // Run; fewer than configured once converged
+    int positionIterations = 0;
+    float residual = 0.0f;         // Largest impulse change in the last velocity iteration
+    float maxPenetration = 0.0f;   // Deepest overlap seen by the last position iteration
+};
+
+// Gravity, forces, damping and circle contacts for entities that opt into
+// physics. A body is a view onto its entity's slot in the shared
+// TransformStore: update() changes velocities there and nudges overlapping
+// positions apart, and the game advances every position once per tick
+// through TransformStore::integrate(), so there is nothing to copy back to
+// the entities afterwards.
+//
+// Contacts are solved with sequential impulses. Each contact keeps its
+// accumulated normal and friction impulses between steps, keyed by body
+// pair, and starts the next step from them, so resting and stacked bodies
+// settle in a few iterations instead of rebuilding the impulse each step.
+//
+// Every step the contacts are split into islands, sets of dynamic bodies
+// that touch each other directly or through other dynamic bodies. Static
+// bodies never join islands, so no two islands write the same body and
+// each can be solved on its own thread. Within an island the contacts are
+// always solved in the same order, so the result does not depend on the
+// number of threads.
 class PhysicsWorld {
 public:
     PhysicsWorld(float gravity = 9.8f);
-    ~PhysicsWorld();
+    
+    // Store the bodies' entities live in; changing it drops every body
+    void setTransforms(TransformStore* transforms);
     
     void update(float deltaTime);
     void setGravity(float gravity);
     
-    b2Body* createBody(Entity* entity, bool isDynamic);
-    void removeBody(b2Body* body);
-    void updateEntityFromBody(Entity* entity, b2Body* body);
+    // Solver configuration. Velocity iterations stop early once no impulse
+    // changes by more than the tolerance (0 runs them all).
+    void setIterations(int velocityIterations, int positionIterations);
+    void setVelocityTolerance(float tolerance) { m_velocityTolerance = tolerance; }
+    void setWarmStarting(bool enabled) { m_warmStarting = enabled; }
+    
+    // Threads that help solve islands besides the caller; 0 solves them
+    // inline. Defaults to the hardware threads less one, 0 in WebAssembly.
+    void setWorkerCount(int count);
+    int getWorkerCount() const { return m_workerCount; }
     
-    Vector2 getBodyPosition(b2Body* body) const;
-    void setBodyPosition(b2Body* body, const Vector2& position);
-    Vector2 getBodyVelocity(b2Body* body) const;
-    void setBodyVelocity(b2Body* body, const Vector2& velocity);
-    float getBodyAngle(b2Body* body) const;
+    // Returns a body handle, -1 when there is no entity or no store.
+    // Handles stay valid until removeBody(); -1 is ignored everywhere.
+    int createBody(Entity* entity, bool isDynamic, const BodyMaterial& material = BodyMaterial());
+    void removeBody(int body);
     
-    void applyForce(b2Body* body, const Vector2& force);
-    void applyImpulse(b2Body* body, const Vector2& impulse);
+    Vector2 getBodyPosition(int body) const;
+    void setBodyPosition(int body, const Vector2& position);
+    Vector2 getBodyVelocity(int body) const;
+    void setBodyVelocity(int body, const Vector2& velocity);
     
+    // Forces are accumulated until the next update(); impulses apply at once
+    void applyForce(int body, const Vector2& force);
+    void applyImpulse(int body, const Vector2& impulse);
+    
+    int getBodyCount() const { return static_cast<int>(m_bodies.size() - m_freeBodies.size()); }
+    const PhysicsStats& getStats() const { return m_stats; }
+
 private:
-    std::unique_ptr<b2World> m_world;
-    std::unordered_map<b2Body*, Entity*> m_bodyEntityMap;
-    float m_timeStep;
+    struct Body {
+        Entity* entity;        // Null while the handle is free
+        int transform;
+        bool dynamic;
+        float inverseMass;     // Zero for static bodies
+        float friction;
+        float restitution;
+        float linearDamping;
+        float radius;          // Refreshed from the entity every step
+        Vector2 force;
+    };
+    
+    // Two overlapping circles; the normal points from a to b
+    struct Contact {
+        uint64_t key;          // Lower body handle in the high word
+        int a;
+        int b;
+        Vector2 normal;
+        float separation;      // Negative while overlapping
+        float normalMass;
+        float friction;
+        float velocityBias;    // Restitution target along the normal
+        float normalImpulse;   // Accumulated over the step, carried to the next
+        float tangentImpulse;
+    };
+    
+    // A run of m_islandContacts and what solving it took
+    struct Island {
+        int firstContact;
+        int contactCount;
+        int velocityIterations;
+        int positionIterations;
+        float residual;
+        float minSeparation;
+    };
+    
+    TransformStore* m_transforms;
+    std::vector<Body> m_bodies;
+    std::vector<int> m_freeBodies;
+    Vector2 m_gravity;
+    
     int m_velocityIterations;
     int m_positionIterations;
+    float m_velocityTolerance;
+    bool m_warmStarting;
     
-    // Contact listener for collision callbacks
-    class ContactListener : public b2ContactListener {
-    public:
-        ContactListener(PhysicsWorld* physicsWorld);
-        
-        virtual void BeginContact(b2Contact* contact) override;
-        virtual void EndContact(b2Contact* contact) override;
-        
-    private:
-        PhysicsWorld* m_physicsWorld;
-    };
+    std::vector<Contact> m_contacts;
+    std::vector<Contact> m_previousContacts;
+    std::vector<int> m_sweep;
+    PhysicsStats m_stats;
+    
+    // Islands, rebuilt every step
+    std::vector<int> m_islandParent;     // Union-find over body handles
+    std::vector<int> m_islandOfRoot;
+    std::vector<int> m_contactIsland;
+    std::vector<int> m_islandContacts;   // Contact indices grouped by island
+    std::vector<Island> m_islands;
+    
+    int m_workerCount;
+    std::unique_ptr<ThreadPool> m_threadPool;   // Created on first use
+    
+    void findContacts();
+    void buildIslands();
+    int findRoot(int body);
+    void solveIsland(Island& island);
+    void prepareContacts(const int* contacts, int count);
+    float solveVelocities(const int* contacts, int count);
+    float solvePositions(const int* contacts, int count);
     
-    std::unique_ptr<ContactListener> m_contactListener;
+    static uint64_t makeKey(int a, int b);
 };
\ No newline at end of file
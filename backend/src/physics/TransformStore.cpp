@@ -0,0 +1,50 @@
+// backend/src/physics/TransformStore.cpp
+#include "TransformStore.h"
+#include <algorithm>
+
+int TransformStore::allocate(const Vector2& position, const Vector2& velocity) {
+    int slot;
+    if (!m_freeSlots.empty()) {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        slot = static_cast<int>(m_positions.size());
+        m_positions.emplace_back();
+        m_velocities.emplace_back();
+    }
+    
+    m_positions[slot] = position;
+    m_velocities[slot] = velocity;
+    return slot;
+}
+
+void TransformStore::release(int slot) {
+    m_velocities[slot] = Vector2(0.0f, 0.0f);
+    m_freeSlots.push_back(slot);
+}
+
+void TransformStore::clear() {
+    m_positions.clear();
+    m_velocities.clear();
+    m_freeSlots.clear();
+}
+
+void TransformStore::reserve(size_t count) {
+    size_t needed = m_positions.size() + count - std::min(count, m_freeSlots.size());
+    if (m_positions.capacity() < needed) {
+        // Grow geometrically so a run of small batches stays amortised
+        size_t capacity = std::max(needed, m_positions.capacity() * 2);
+        m_positions.reserve(capacity);
+        m_velocities.reserve(capacity);
+    }
+}
+
+void TransformStore::integrate(float deltaTime) {
+    Vector2* positions = m_positions.data();
+    const Vector2* velocities = m_velocities.data();
+    size_t count = m_positions.size();
+    for (size_t i = 0; i < count; ++i) {
+        positions[i].x += velocities[i].x * deltaTime;
+        positions[i].y += velocities[i].y * deltaTime;
+    }
+}
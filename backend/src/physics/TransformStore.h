@@ -0,0 +1,37 @@
+// backend/src/physics/TransformStore.h
+#pragma once
+
+#include <vector>
+#include "../vector2.h"
+
+// The one copy of every entity's position and velocity, packed by slot.
+// Entities and physics bodies both hold a slot index into the same store,
+// so nothing is synchronised between them, and integrate() is the only
+// place positions advance. Released slots keep a zero velocity, which
+// lets integrate() sweep the arrays without checking which slots are live.
+class TransformStore {
+public:
+    // Returns a slot that stays valid until release() or clear()
+    int allocate(const Vector2& position, const Vector2& velocity = Vector2());
+    void release(int slot);
+    void clear();
+    
+    // Makes room for count more slots without reallocating
+    void reserve(size_t count);
+    
+    Vector2 getPosition(int slot) const { return m_positions[slot]; }
+    void setPosition(int slot, const Vector2& position) { m_positions[slot] = position; }
+    Vector2 getVelocity(int slot) const { return m_velocities[slot]; }
+    void setVelocity(int slot, const Vector2& velocity) { m_velocities[slot] = velocity; }
+    
+    // position += velocity * deltaTime for every slot
+    void integrate(float deltaTime);
+    
+    int getLiveCount() const { return static_cast<int>(m_positions.size() - m_freeSlots.size()); }
+    int getCapacity() const { return static_cast<int>(m_positions.size()); }
+
+private:
+    std::vector<Vector2> m_positions;
+    std::vector<Vector2> m_velocities;
+    std::vector<int> m_freeSlots;
+};
@@ -0,0 +1,135 @@
+// backend/src/profiling/Profiler.cpp
+#include "Profiler.h"
+#include <fstream>
+#include <sstream>
+
+thread_local bool Profiler::s_threadEnabled = true;
+
+Profiler::Profiler()
+    : m_events(65536),
+      m_eventHead(0),
+      m_eventCount(0),
+      m_epoch(Clock::now()) {
+    m_zones.reserve(kMaxProfileZones);
+    m_frameTotals.reserve(kMaxProfileZones);
+}
+
+int Profiler::registerZone(const char* name) {
+    std::lock_guard<std::mutex> lock(m_registerMutex);
+    for (size_t i = 0; i < m_zones.size(); ++i) {
+        if (m_zones[i].name == name) {
+            return static_cast<int>(i);
+        }
+    }
+    
+    if (m_zones.size() == kMaxProfileZones) {
+        return static_cast<int>(kMaxProfileZones - 1);
+    }
+    
+    ProfileZoneStats zone;
+    zone.name = m_zones.size() == kMaxProfileZones - 1 ? "(other zones)" : name;
+    m_zones.push_back(zone);
+    m_frameTotals.push_back(0.0);
+    return static_cast<int>(m_zones.size() - 1);
+}
+
+void Profiler::beginFrame() {
+    std::lock_guard<std::mutex> lock(m_registerMutex);
+    for (double& total : m_frameTotals) {
+        total = 0.0;
+    }
+}
+
+void Profiler::endFrame() {
+    std::lock_guard<std::mutex> lock(m_registerMutex);
+    for (size_t i = 0; i < m_zones.size(); ++i) {
+        ProfileZoneStats& zone = m_zones[i];
+        double frameUs = m_frameTotals[i];
+        
+        zone.lastFrameUs = frameUs;
+        zone.totalUs += frameUs;
+        zone.frames++;
+        if (frameUs > zone.maxFrameUs) {
+            zone.maxFrameUs = frameUs;
+        }
+        
+        int bucket = 0;
+        uint64_t us = static_cast<uint64_t>(frameUs);
+        while (us > 0 && bucket < kProfileHistogramBuckets - 1) {
+            us >>= 1;
+            ++bucket;
+        }
+        zone.histogram[bucket]++;
+    }
+}
+
+void Profiler::record(int zoneId, Clock::time_point start, Clock::time_point end) {
+    double durationUs = std::chrono::duration<double, std::micro>(end - start).count();
+    m_frameTotals[zoneId] += durationUs;
+    m_zones[zoneId].calls++;
+    
+    if (m_events.empty()) {
+        return;
+    }
+    
+    Event& event = m_events[m_eventHead];
+    event.zoneId = zoneId;
+    event.startUs = std::chrono::duration_cast<std::chrono::microseconds>(start - m_epoch).count();
+    event.durationUs = static_cast<int64_t>(durationUs);
+    
+    m_eventHead = (m_eventHead + 1) % m_events.size();
+    if (m_eventCount < m_events.size()) {
+        m_eventCount++;
+    }
+}
+
+void Profiler::reset() {
+    std::lock_guard<std::mutex> lock(m_registerMutex);
+    for (size_t i = 0; i < m_zones.size(); ++i) {
+        std::string name = m_zones[i].name;
+        m_zones[i] = ProfileZoneStats();
+        m_zones[i].name = name;
+        m_frameTotals[i] = 0.0;
+    }
+    m_eventHead = 0;
+    m_eventCount = 0;
+}
+
+void Profiler::setEventCapacity(size_t capacity) {
+    m_events.assign(capacity, Event());
+    m_eventHead = 0;
+    m_eventCount = 0;
+}
+
+void Profiler::writeChromeTrace(std::ostream& out) const {
+    out << "{\"traceEvents\":[";
+    
+    // Oldest event first
+    size_t first = (m_eventHead + m_events.size() - m_eventCount) % (m_events.empty() ? 1 : m_events.size());
+    for (size_t n = 0; n < m_eventCount; ++n) {
+        const Event& event = m_events[(first + n) % m_events.size()];
+        if (n > 0) {
+            out << ',';
+        }
+        out << "{\"name\":\"" << m_zones[event.zoneId].name
+            << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" << event.startUs
+            << ",\"dur\":" << event.durationUs << '}';
+    }
+    
+    out << "],\"displayTimeUnit\":\"ms\"}";
+}
+
+std::string Profiler::getChromeTrace() const {
+    std::ostringstream out;
+    writeChromeTrace(out);
+    return out.str();
+}
+
+bool Profiler::saveChromeTrace(const std::string& filePath) const {
+    std::ofstream file(filePath);
+    if (!file) {
+        return false;
+    }
+    writeChromeTrace(file);
+    return static_cast<bool>(file);
+}
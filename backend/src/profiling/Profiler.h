@@ -0,0 +1,138 @@
+// backend/src/profiling/Profiler.h
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Instrumentation is compiled in unless DODGEBALL_PROFILING is defined to 0
+#ifndef DODGEBALL_PROFILING
+#define DODGEBALL_PROFILING 1
+#endif
+
+// Number of power-of-two microsecond buckets in each zone histogram
+constexpr int kProfileHistogramBuckets = 16;
+
+// Zone storage is reserved up front and never moves; zones past the
+// limit share the last slot
+constexpr size_t kMaxProfileZones = 256;
+
+// Aggregated timings for one named zone
+struct ProfileZoneStats {
+    std::string name;
+    
+    // Time spent in the zone during the last completed frame
+    double lastFrameUs = 0.0;
+    double maxFrameUs = 0.0;
+    double totalUs = 0.0;
+    uint64_t frames = 0;
+    uint64_t calls = 0;
+    
+    // Bucket b counts frames that spent [2^(b-1), 2^b) microseconds in the zone;
+    // bucket 0 is under 1 us and the last bucket is open-ended
+    uint32_t histogram[kProfileHistogramBuckets] = {};
+};
+
+// Collects scoped-timer samples, aggregates them into per-zone frame
+// histograms and keeps a bounded window of raw events for trace export.
+// Recording is not thread-safe; zones are timed on the simulation thread
+// only. Threads that step simulations in parallel switch their zones off,
+// but still register the zones they pass through.
+class Profiler {
+public:
+    using Clock = std::chrono::steady_clock;
+    
+    static Profiler& getInstance() {
+        static Profiler instance;
+        return instance;
+    }
+    
+    // Zones are registered once and referred to by index afterwards.
+    // Safe to call from any thread: storage is reserved, so a registration
+    // never moves the zones another thread is recording into.
+    int registerZone(const char* name);
+    
+    // Whether zones on the calling thread are timed; on by default
+    static void setThreadEnabled(bool enabled) { s_threadEnabled = enabled; }
+    static bool isThreadEnabled() { return s_threadEnabled; }
+    
+    void beginFrame();
+    void endFrame();
+    
+    void record(int zoneId, Clock::time_point start, Clock::time_point end);
+    
+    const std::vector<ProfileZoneStats>& getZoneStats() const { return m_zones; }
+    void reset();
+    
+    // Chrome trace ("Trace Event Format") export of the buffered events
+    void writeChromeTrace(std::ostream& out) const;
+    std::string getChromeTrace() const;
+    bool saveChromeTrace(const std::string& filePath) const;
+    
+    // Maximum number of raw events kept for export; older events are dropped
+    void setEventCapacity(size_t capacity);
+
+private:
+    Profiler();
+    
+    struct Event {
+        int zoneId;
+        int64_t startUs;
+        int64_t durationUs;
+    };
+    
+    std::vector<ProfileZoneStats> m_zones;
+    std::vector<double> m_frameTotals;
+    
+    // Ring buffer of raw events
+    std::vector<Event> m_events;
+    size_t m_eventHead;
+    size_t m_eventCount;
+    
+    Clock::time_point m_epoch;
+    std::mutex m_registerMutex;
+    
+    static thread_local bool s_threadEnabled;
+};
+
+// Records the lifetime of the enclosing scope against a zone
+class ProfileScope {
+public:
+    explicit ProfileScope(int zoneId)
+        : m_zoneId(zoneId), m_start(Profiler::Clock::now()) {
+    }
+    
+    ~ProfileScope() {
+        if (Profiler::isThreadEnabled()) {
+            Profiler::getInstance().record(m_zoneId, m_start, Profiler::Clock::now());
+        }
+    }
+    
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    int m_zoneId;
+    Profiler::Clock::time_point m_start;
+};
+
+#define DODGEBALL_PROFILE_CONCAT_INNER(a, b) a##b
+#define DODGEBALL_PROFILE_CONCAT(a, b) DODGEBALL_PROFILE_CONCAT_INNER(a, b)
+
+#if DODGEBALL_PROFILING
+// Times the rest of the enclosing scope under the given zone name
+#define PROFILE_ZONE(name) \
+    static const int DODGEBALL_PROFILE_CONCAT(profileZoneId_, __LINE__) = \
+        Profiler::getInstance().registerZone(name); \
+    ProfileScope DODGEBALL_PROFILE_CONCAT(profileScope_, __LINE__)(DODGEBALL_PROFILE_CONCAT(profileZoneId_, __LINE__))
+#define PROFILE_BEGIN_FRAME() Profiler::getInstance().beginFrame()
+#define PROFILE_END_FRAME() Profiler::getInstance().endFrame()
+#else
+#define PROFILE_ZONE(name) ((void)0)
+#define PROFILE_BEGIN_FRAME() ((void)0)
+#define PROFILE_END_FRAME() ((void)0)
+#endif
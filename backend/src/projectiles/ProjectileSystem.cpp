@@ -0,0 +1,183 @@
+// backend/src/projectiles/ProjectileSystem.cpp
+#include "ProjectileSystem.h"
+#include "../collision/HierarchicalGrid.h"
+#include "../Entity.h"
+#include "../entities/Archetypes.h"
+#include "../profiling/Profiler.h"
+#include "../replay/BinaryStream.h"
+
+ProjectileSystem::ProjectileSystem(size_t capacity)
+    : m_capacity(capacity),
+      m_count(0),
+      m_posX(capacity),
+      m_posY(capacity),
+      m_velX(capacity),
+      m_velY(capacity),
+      m_timeLeft(capacity),
+      m_sourceId(capacity),
+      m_type(capacity),
+      m_boundsMin(0.0f, 0.0f),
+      m_boundsMax(800.0f, 600.0f),
+      m_droppedSpawns(0) {
+}
+
+bool ProjectileSystem::spawn(const Vector2& position, const Vector2& velocity, ProjectileType type, int sourceId) {
+    if (m_count >= m_capacity) {
+        m_droppedSpawns++;
+        return false;
+    }
+    
+    size_t i = m_count++;
+    m_posX[i] = position.x;
+    m_posY[i] = position.y;
+    m_velX[i] = velocity.x;
+    m_velY[i] = velocity.y;
+    m_timeLeft[i] = getArchetype(type).lifetime;
+    m_sourceId[i] = sourceId;
+    m_type[i] = static_cast<uint8_t>(type);
+    return true;
+}
+
+void ProjectileSystem::update(float deltaTime) {
+    PROFILE_ZONE("ProjectileSystem::update");
+    
+    size_t count = m_count;
+    float* posX = m_posX.data();
+    float* posY = m_posY.data();
+    const float* velX = m_velX.data();
+    const float* velY = m_velY.data();
+    float* timeLeft = m_timeLeft.data();
+    
+    // Integration and ageing; simple loops over separate arrays vectorize well
+    for (size_t i = 0; i < count; ++i) {
+        posX[i] += velX[i] * deltaTime;
+        posY[i] += velY[i] * deltaTime;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        timeLeft[i] -= deltaTime;
+    }
+    
+    // Projectiles that left the play area, by more than their radius, expire immediately
+    const uint8_t* types = m_type.data();
+    const float radii[] = {getArchetype(ProjectileType::PLAYER).radius, getArchetype(ProjectileType::ENEMY).radius};
+    for (size_t i = 0; i < count; ++i) {
+        float radius = radii[types[i]];
+        bool outside = posX[i] < m_boundsMin.x - radius || posX[i] > m_boundsMax.x + radius ||
+                       posY[i] < m_boundsMin.y - radius || posY[i] > m_boundsMax.y + radius;
+        timeLeft[i] = outside ? 0.0f : timeLeft[i];
+    }
+    
+    compact();
+}
+
+void ProjectileSystem::collide(const HierarchicalGrid& grid, const std::vector<std::shared_ptr<Entity>>& targets) {
+    PROFILE_ZONE("ProjectileSystem::collide");
+    
+    m_hits.clear();
+    m_broadphaseCounts = BroadphaseCounts();
+    m_targetHit.assign(targets.size(), 0);
+    
+    for (size_t i = 0; i < m_count; ++i) {
+        // Player projectiles damage drones, enemy projectiles damage the player
+        ProjectileType type = static_cast<ProjectileType>(m_type[i]);
+        CollisionFilter filter(CollisionCategory::PROJECTILE, getArchetype(type).targets, m_sourceId[i]);
+        int victimIndex = -1;
+        
+        // Targets already struck this call are passed over, so one kill is reported once
+        m_broadphaseCounts += grid.queryCircle(Vector2(m_posX[i], m_posY[i]), getArchetype(type).radius, filter, -1,
+                                               [&](int targetIndex) {
+            if ((victimIndex < 0 || targetIndex < victimIndex) && !m_targetHit[targetIndex] &&
+                targets[targetIndex]->isActive()) {
+                victimIndex = targetIndex;
+            }
+        });
+        
+        if (victimIndex >= 0) {
+            m_targetHit[victimIndex] = 1;
+            m_hits.push_back({targets[victimIndex].get(), type, m_sourceId[i]});
+            m_timeLeft[i] = 0.0f;
+        }
+    }
+    
+    if (!m_hits.empty()) {
+        compact();
+    }
+}
+
+float ProjectileSystem::getRadius(size_t index) const {
+    return getArchetype(getType(index)).radius;
+}
+
+void ProjectileSystem::compact() {
+    // Stream compaction keeps survivors in spawn order
+    size_t write = 0;
+    for (size_t read = 0; read < m_count; ++read) {
+        if (m_timeLeft[read] <= 0.0f) {
+            continue;
+        }
+        if (write != read) {
+            m_posX[write] = m_posX[read];
+            m_posY[write] = m_posY[read];
+            m_velX[write] = m_velX[read];
+            m_velY[write] = m_velY[read];
+            m_timeLeft[write] = m_timeLeft[read];
+            m_sourceId[write] = m_sourceId[read];
+            m_type[write] = m_type[read];
+        }
+        ++write;
+    }
+    m_count = write;
+}
+
+void ProjectileSystem::clear() {
+    m_count = 0;
+    m_hits.clear();
+}
+
+void ProjectileSystem::setBounds(const Vector2& min, const Vector2& max) {
+    m_boundsMin = min;
+    m_boundsMax = max;
+}
+
+void ProjectileSystem::saveState(BinaryWriter& writer) const {
+    writer.write(static_cast<uint32_t>(m_count));
+    
+    // Array by array, matching the in-memory layout
+    writer.writeBytes(m_posX.data(), m_count * sizeof(float));
+    writer.writeBytes(m_posY.data(), m_count * sizeof(float));
+    writer.writeBytes(m_velX.data(), m_count * sizeof(float));
+    writer.writeBytes(m_velY.data(), m_count * sizeof(float));
+    writer.writeBytes(m_timeLeft.data(), m_count * sizeof(float));
+    writer.writeBytes(m_sourceId.data(), m_count * sizeof(int));
+    writer.writeBytes(m_type.data(), m_count * sizeof(uint8_t));
+}
+
+bool ProjectileSystem::loadState(BinaryReader& reader) {
+    size_t count = reader.read<uint32_t>();
+    if (count > m_capacity) {
+        clear();
+        return false;
+    }
+    
+    reader.readBytes(m_posX.data(), count * sizeof(float));
+    reader.readBytes(m_posY.data(), count * sizeof(float));
+    reader.readBytes(m_velX.data(), count * sizeof(float));
+    reader.readBytes(m_velY.data(), count * sizeof(float));
+    reader.readBytes(m_timeLeft.data(), count * sizeof(float));
+    reader.readBytes(m_sourceId.data(), count * sizeof(int));
+    reader.readBytes(m_type.data(), count * sizeof(uint8_t));
+    
+    // Types index the archetype tables
+    bool typesValid = true;
+    for (size_t i = 0; i < count; ++i) {
+        typesValid = typesValid && m_type[i] < kProjectileTypeCount;
+    }
+    if (reader.failed() || !typesValid) {
+        clear();
+        return false;
+    }
+    
+    m_count = count;
+    m_hits.clear();
+    return true;
+}
@@ -0,0 +1,86 @@
+// backend/src/projectiles/ProjectileSystem.h
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include "../vector2.h"
+#include "../include/Projectile.h"
+#include "../collision/HierarchicalGrid.h"
+
+class Entity;
+class BinaryWriter;
+class BinaryReader;
+
+// A projectile that struck an entity this frame
+struct ProjectileHit {
+    Entity* target;
+    ProjectileType type;
+    int sourceId;
+};
+
+constexpr size_t kDefaultProjectileCapacity = 65536;
+
+// Pooled, structure-of-arrays storage for every live bullet.
+// Projectiles are plain data updated by batch kernels rather than
+// polymorphic entities, so large bullet-hell waves stay cheap.
+class ProjectileSystem {
+public:
+    explicit ProjectileSystem(size_t capacity = kDefaultProjectileCapacity);
+    
+    // Returns false when the pool is full
+    bool spawn(const Vector2& position, const Vector2& velocity, ProjectileType type, int sourceId);
+    
+    // Integrate, age and cull projectiles that left the bounds or expired
+    void update(float deltaTime);
+    
+    // Test every projectile against the targets in the broadphase.
+    // Projectiles that hit are consumed; hits are available from getHits().
+    // A projectile overlapping several targets hits the one with the lowest
+    // index, independent of the broadphase's internal order. Each target is
+    // hit at most once per call; later projectiles overlapping it stay live.
+    void collide(const HierarchicalGrid& grid, const std::vector<std::shared_ptr<Entity>>& targets);
+    const std::vector<ProjectileHit>& getHits() const { return m_hits; }
+    const BroadphaseCounts& getBroadphaseCounts() const { return m_broadphaseCounts; }
+    
+    void clear();
+    void setBounds(const Vector2& min, const Vector2& max);
+    
+    // Replay keyframes: live projectiles. Returns false if the saved pool
+    // does not fit this pool's capacity.
+    void saveState(BinaryWriter& writer) const;
+    bool loadState(BinaryReader& reader);
+    
+    // Read access for rendering and statistics
+    size_t getCount() const { return m_count; }
+    size_t getCapacity() const { return m_capacity; }
+    Vector2 getPosition(size_t index) const { return Vector2(m_posX[index], m_posY[index]); }
+    Vector2 getVelocity(size_t index) const { return Vector2(m_velX[index], m_velY[index]); }
+    ProjectileType getType(size_t index) const { return static_cast<ProjectileType>(m_type[index]); }
+    float getRadius(size_t index) const;
+    unsigned int getDroppedSpawns() const { return m_droppedSpawns; }
+
+private:
+    size_t m_capacity;
+    size_t m_count;
+    
+    // Structure of arrays, sized to capacity up front
+    std::vector<float> m_posX;
+    std::vector<float> m_posY;
+    std::vector<float> m_velX;
+    std::vector<float> m_velY;
+    std::vector<float> m_timeLeft;
+    std::vector<int> m_sourceId;
+    std::vector<uint8_t> m_type;
+    
+    std::vector<ProjectileHit> m_hits;
+    std::vector<uint8_t> m_targetHit;
+    BroadphaseCounts m_broadphaseCounts;
+    
+    Vector2 m_boundsMin;
+    Vector2 m_boundsMax;
+    unsigned int m_droppedSpawns;
+    
+    // Removes every projectile whose remaining time is not positive
+    void compact();
+};
@@ -0,0 +1,77 @@
+// backend/src/render/DrawList.cpp
+#include "DrawList.h"
+#include "../Game.h"
+#include "../profiling/Profiler.h"
+
+namespace {
+bool isVisible(const DrawViewport& viewport, const Vector2& position, float radius) {
+    return !viewport.enabled ||
+           (position.x + radius >= viewport.minX && position.x - radius <= viewport.maxX &&
+            position.y + radius >= viewport.minY && position.y - radius <= viewport.maxY);
+}
+}
+
+void DrawList::build(const Game& game, const DrawViewport& viewport) {
+    PROFILE_ZONE("DrawList::build");
+    
+    const auto& entities = game.getEntities();
+    const ProjectileSystem& projectiles = game.getProjectiles();
+    const int projectileType = static_cast<int>(EntityType::PROJECTILE);
+    
+    // Count the visible items of each type
+    m_header = DrawListHeader();
+    for (const auto& entity : entities) {
+        if (isVisible(viewport, entity->getPosition(), entity->getRadius())) {
+            m_header.counts[static_cast<int>(entity->getType())]++;
+        } else {
+            m_header.culled++;
+        }
+    }
+    for (size_t i = 0; i < projectiles.getCount(); ++i) {
+        if (isVisible(viewport, projectiles.getPosition(i), projectiles.getRadius(i))) {
+            m_header.counts[projectileType]++;
+        } else {
+            m_header.culled++;
+        }
+    }
+    
+    // Each group starts where the previous one ends
+    uint32_t next[kDrawTypeCount];
+    for (int type = 0; type < kDrawTypeCount; ++type) {
+        m_header.offsets[type] = m_header.count;
+        next[type] = m_header.count;
+        m_header.count += m_header.counts[type];
+    }
+    m_items.resize(m_header.count);
+    
+    // Scatter into the groups
+    for (const auto& entity : entities) {
+        Vector2 position = entity->getPosition();
+        if (isVisible(viewport, position, entity->getRadius())) {
+            m_items[next[static_cast<int>(entity->getType())]++] = {entity->getId(), position.x, position.y, entity->getRadius()};
+        }
+    }
+    for (size_t i = 0; i < projectiles.getCount(); ++i) {
+        Vector2 position = projectiles.getPosition(i);
+        float radius = projectiles.getRadius(i);
+        if (isVisible(viewport, position, radius)) {
+            m_items[next[projectileType]++] = {-1, position.x, position.y, radius};
+        }
+    }
+}
+
+void DrawList::clear() {
+    m_header = DrawListHeader();
+    m_items.clear();
+}
+
+void DrawList::add(EntityType type, const DrawItem& item) {
+    // Later groups move up by one item
+    int group = static_cast<int>(type);
+    m_items.insert(m_items.begin() + m_header.offsets[group] + m_header.counts[group], item);
+    m_header.counts[group]++;
+    m_header.count++;
+    for (int later = group + 1; later < kDrawTypeCount; ++later) {
+        m_header.offsets[later]++;
+    }
+}
@@ -0,0 +1,72 @@
+// backend/src/render/DrawList.h
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+#include "../Entity.h"
+
+class Game;
+
+// Bump when DrawListHeader or DrawItem change; readers check it
+constexpr uint32_t kDrawListVersion = 1;
+
+constexpr int kDrawTypeCount = 4;   // One group per EntityType
+
+// One circle to draw; its EntityType is implied by the group it is in
+struct DrawItem {
+    int32_t id;         // -1 for pooled projectiles
+    float x;
+    float y;
+    float radius;
+};
+
+// Layout of the draw list in memory. Items of type t are
+// items[offsets[t] .. offsets[t] + counts[t]). Every field is 4 bytes;
+// keep the order in sync with wasmModule.js.
+struct DrawListHeader {
+    uint32_t version = kDrawListVersion;
+    uint32_t count = 0;                 // Items in the list
+    uint32_t culled = 0;                // Items skipped by the viewport
+    uint32_t offsets[kDrawTypeCount] = {0, 0, 0, 0};
+    uint32_t counts[kDrawTypeCount] = {0, 0, 0, 0};
+};
+
+static_assert(std::is_trivially_copyable<DrawItem>::value, "DrawItem is read straight from memory");
+static_assert(sizeof(DrawItem) == 4 * 4, "DrawItem layout changed; update wasmModule.js");
+static_assert(sizeof(DrawListHeader) == 11 * 4, "DrawListHeader layout changed; update wasmModule.js");
+
+// Axis-aligned visible area; circles entirely outside it are culled
+struct DrawViewport {
+    float minX = 0.0f;
+    float minY = 0.0f;
+    float maxX = 0.0f;
+    float maxY = 0.0f;
+    bool enabled = false;
+};
+
+// Render-ready snapshot of the game, grouped by EntityType so a renderer
+// can set up each draw style once and draw the whole group. Built with a
+// counting sort over the entities and the projectile pool; order within
+// a group follows the game's update order. The item storage is reused
+// between builds.
+class DrawList {
+public:
+    void build(const Game& game, const DrawViewport& viewport = DrawViewport());
+    
+    // Hand-built lists, e.g. fixed scenes for golden frames: empty the
+    // list, then append each item to the end of its type's group
+    void clear();
+    void add(EntityType type, const DrawItem& item);
+    
+    const DrawListHeader& getHeader() const { return m_header; }
+    const DrawItem* getItems() const { return m_items.data(); }
+    
+    // Items of one type
+    const DrawItem* begin(EntityType type) const { return m_items.data() + m_header.offsets[static_cast<int>(type)]; }
+    uint32_t count(EntityType type) const { return m_header.counts[static_cast<int>(type)]; }
+
+private:
+    DrawListHeader m_header;
+    std::vector<DrawItem> m_items;
+};
@@ -0,0 +1,235 @@
+// backend/src/render/SoftwareRasterizer.cpp
+#include "SoftwareRasterizer.h"
+#include "../Game.h"
+#include "../profiling/Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#endif
+
+namespace {
+// Back to front, matching GameCanvas.js
+constexpr EntityType kDrawOrder[kDrawTypeCount] = {
+    EntityType::PLAYER, EntityType::DRONE, EntityType::POWERUP, EntityType::PROJECTILE
+};
+
+// Small circles still cover the pixel under their centre
+const float kMinRadiusPixels = 0.5f;
+
+// Clamped before any int cast, so far-off or NaN items cannot overflow; NaN becomes low
+float clampPixel(float value, float low, float high) {
+    return std::min(high, std::max(low, value));
+}
+
+uint8_t luminance(uint8_t r, uint8_t g, uint8_t b) {
+    return static_cast<uint8_t>((77 * r + 150 * g + 29 * b) >> 8);
+}
+
+// Next header field of a PNM file, skipping whitespace and comments
+bool readPnmField(std::istream& in, int& value) {
+    in >> std::ws;
+    while (in.peek() == '#') {
+        in.ignore(4096, '\n');
+        in >> std::ws;
+    }
+    return static_cast<bool>(in >> value);
+}
+}
+
+SoftwareRasterizer::SoftwareRasterizer(int width, int height, PixelFormat format)
+    : m_width(0),
+      m_height(0),
+      m_format(format),
+      m_worldMinX(0.0f),
+      m_worldMinY(0.0f),
+      m_worldMaxX(800.0f),
+      m_worldMaxY(600.0f),
+      m_scaleX(1.0f),
+      m_scaleY(1.0f),
+      m_colors{{0x42, 0x87, 0xf5}, {0xe7, 0x4c, 0x3c}, {0xf1, 0xc4, 0x0f}, {0x2e, 0xcc, 0x71}},
+      m_background{0, 0, 0} {
+    resize(width, height, format);
+}
+
+void SoftwareRasterizer::resize(int width, int height, PixelFormat format) {
+    m_width = std::max(width, 1);
+    m_height = std::max(height, 1);
+    m_format = format;
+    m_pixels.assign(static_cast<size_t>(m_height) * getStride(), 0);
+    updateScale();
+}
+
+void SoftwareRasterizer::setWorldRect(float minX, float minY, float maxX, float maxY) {
+    m_worldMinX = minX;
+    m_worldMinY = minY;
+    m_worldMaxX = maxX;
+    m_worldMaxY = maxY;
+    updateScale();
+}
+
+void SoftwareRasterizer::updateScale() {
+    m_scaleX = m_worldMaxX > m_worldMinX ? m_width / (m_worldMaxX - m_worldMinX) : 1.0f;
+    m_scaleY = m_worldMaxY > m_worldMinY ? m_height / (m_worldMaxY - m_worldMinY) : 1.0f;
+}
+
+void SoftwareRasterizer::setColor(EntityType type, uint8_t r, uint8_t g, uint8_t b) {
+    m_colors[static_cast<int>(type)] = {r, g, b};
+}
+
+void SoftwareRasterizer::setBackground(uint8_t r, uint8_t g, uint8_t b) {
+    m_background = {r, g, b};
+}
+
+SoftwareRasterizer::FillPattern SoftwareRasterizer::makePattern(const Color& color) const {
+    FillPattern pattern;
+    if (m_format == PixelFormat::RGB8) {
+        for (int i = 0; i < 48; i += 3) {
+            pattern.bytes[i] = color.r;
+            pattern.bytes[i + 1] = color.g;
+            pattern.bytes[i + 2] = color.b;
+        }
+    } else {
+        std::memset(pattern.bytes, luminance(color.r, color.g, color.b), sizeof(pattern.bytes));
+    }
+    return pattern;
+}
+
+void SoftwareRasterizer::fillSpan(uint8_t* row, int x0, int x1, const FillPattern& pattern) const {
+    int bytesPerPixel = getBytesPerPixel();
+    uint8_t* out = row + static_cast<size_t>(x0) * bytesPerPixel;
+    size_t bytes = static_cast<size_t>(x1 - x0 + 1) * bytesPerPixel;
+    
+    // Pixels start on a pattern boundary, so the pattern repeats every 48 bytes
+#if defined(__SSE2__)
+    const __m128i p0 = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern.bytes));
+    const __m128i p1 = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern.bytes + 16));
+    const __m128i p2 = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern.bytes + 32));
+    for (; bytes >= 48; bytes -= 48, out += 48) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), p0);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16), p1);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 32), p2);
+    }
+#elif defined(__wasm_simd128__)
+    const v128_t p0 = wasm_v128_load(pattern.bytes);
+    const v128_t p1 = wasm_v128_load(pattern.bytes + 16);
+    const v128_t p2 = wasm_v128_load(pattern.bytes + 32);
+    for (; bytes >= 48; bytes -= 48, out += 48) {
+        wasm_v128_store(out, p0);
+        wasm_v128_store(out + 16, p1);
+        wasm_v128_store(out + 32, p2);
+    }
+#else
+    for (; bytes >= 48; bytes -= 48, out += 48) {
+        std::memcpy(out, pattern.bytes, 48);
+    }
+#endif
+    std::memcpy(out, pattern.bytes, bytes);
+}
+
+void SoftwareRasterizer::fillCircle(const DrawItem& item, const FillPattern& pattern) {
+    float cx = (item.x - m_worldMinX) * m_scaleX;
+    float cy = (item.y - m_worldMinY) * m_scaleY;
+    float rx = std::max(item.radius * m_scaleX, kMinRadiusPixels);
+    float ry = std::max(item.radius * m_scaleY, kMinRadiusPixels);
+    
+    // Pixel (x, y) is covered when its centre (x + 0.5, y + 0.5) is inside
+    float top = clampPixel(cy - ry - 0.5f, -1.0f, static_cast<float>(m_height));
+    float bottom = clampPixel(cy + ry - 0.5f, -1.0f, static_cast<float>(m_height));
+    int y0 = std::max(static_cast<int>(std::ceil(top)), 0);
+    int y1 = std::min(static_cast<int>(std::floor(bottom)), m_height - 1);
+    
+    size_t stride = getStride();
+    for (int y = y0; y <= y1; ++y) {
+        float t = (y + 0.5f - cy) / ry;
+        float halfWidth = rx * std::sqrt(std::max(1.0f - t * t, 0.0f));
+        float left = clampPixel(cx - halfWidth - 0.5f, -1.0f, static_cast<float>(m_width));
+        float right = clampPixel(cx + halfWidth - 0.5f, -1.0f, static_cast<float>(m_width));
+        int x0 = std::max(static_cast<int>(std::ceil(left)), 0);
+        int x1 = std::min(static_cast<int>(std::floor(right)), m_width - 1);
+        if (x0 <= x1) {
+            fillSpan(m_pixels.data() + y * stride, x0, x1, pattern);
+        }
+    }
+}
+
+void SoftwareRasterizer::render(const DrawList& list) {
+    PROFILE_ZONE("SoftwareRasterizer::render");
+    
+    // The background is one long span
+    FillPattern background = makePattern(m_background);
+    fillSpan(m_pixels.data(), 0, static_cast<int>(m_pixels.size() / getBytesPerPixel()) - 1, background);
+    
+    for (EntityType type : kDrawOrder) {
+        FillPattern pattern = makePattern(m_colors[static_cast<int>(type)]);
+        const DrawItem* items = list.begin(type);
+        uint32_t count = list.count(type);
+        for (uint32_t i = 0; i < count; ++i) {
+            fillCircle(items[i], pattern);
+        }
+    }
+}
+
+void SoftwareRasterizer::render(const Game& game) {
+    DrawViewport viewport;
+    viewport.minX = m_worldMinX;
+    viewport.minY = m_worldMinY;
+    viewport.maxX = m_worldMaxX;
+    viewport.maxY = m_worldMaxY;
+    viewport.enabled = true;
+    m_drawList.build(game, viewport);
+    render(m_drawList);
+}
+
+bool SoftwareRasterizer::savePnm(const std::string& filePath) const {
+    std::ofstream file(filePath, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    
+    file << (m_format == PixelFormat::RGB8 ? "P6" : "P5") << "\n" << m_width << " " << m_height << "\n255\n";
+    file.write(reinterpret_cast<const char*>(m_pixels.data()), static_cast<std::streamsize>(m_pixels.size()));
+    return static_cast<bool>(file);
+}
+
+bool SoftwareRasterizer::loadPnm(const std::string& filePath, std::vector<uint8_t>& pixels,
+                                 int& width, int& height, PixelFormat& format) {
+    std::ifstream file(filePath, std::ios::binary);
+    std::string magic;
+    if (!(file >> magic) || (magic != "P5" && magic != "P6")) {
+        return false;
+    }
+    
+    int maxValue = 0;
+    if (!readPnmField(file, width) || !readPnmField(file, height) || !readPnmField(file, maxValue) ||
+        width <= 0 || height <= 0 || maxValue != 255) {
+        return false;
+    }
+    file.get();     // The single whitespace byte before the pixels
+    
+    format = magic == "P6" ? PixelFormat::RGB8 : PixelFormat::GRAY8;
+    pixels.resize(static_cast<size_t>(width) * height * (format == PixelFormat::RGB8 ? 3 : 1));
+    file.read(reinterpret_cast<char*>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
+    return file.gcount() == static_cast<std::streamsize>(pixels.size());
+}
+
+size_t SoftwareRasterizer::countDifferentPixels(const uint8_t* a, const uint8_t* b, size_t pixelCount,
+                                                int bytesPerPixel, int tolerance) {
+    size_t different = 0;
+    for (size_t i = 0; i < pixelCount; ++i) {
+        for (int c = 0; c < bytesPerPixel; ++c) {
+            size_t index = i * bytesPerPixel + c;
+            if (std::abs(static_cast<int>(a[index]) - static_cast<int>(b[index])) > tolerance) {
+                different++;
+                break;
+            }
+        }
+    }
+    return different;
+}
@@ -0,0 +1,86 @@
+// backend/src/replay/BinaryStream.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+// Little helpers for the replay format. Values are copied byte for byte in
+// host order; replays are read back by the same build that wrote them.
+class BinaryWriter {
+public:
+    explicit BinaryWriter(std::vector<uint8_t>& buffer) : m_buffer(buffer) {}
+    
+    template<typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "BinaryWriter only writes plain data");
+        writeBytes(&value, sizeof(T));
+    }
+    
+    void writeBytes(const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+    }
+    
+    size_t getSize() const { return m_buffer.size(); }
+
+private:
+    std::vector<uint8_t>& m_buffer;
+};
+
+// Bounds-checked reader over borrowed memory (e.g. a mapped replay file).
+// A read past the end zero-fills the value and sets the failure flag, so
+// callers can check once after decoding a whole block.
+class BinaryReader {
+public:
+    BinaryReader(const void* data, size_t size)
+        : m_data(static_cast<const uint8_t*>(data)), m_size(size), m_offset(0), m_failed(false) {}
+    
+    template<typename T>
+    T read() {
+        static_assert(std::is_trivially_copyable<T>::value, "BinaryReader only reads plain data");
+        T value;
+        readBytes(&value, sizeof(T));
+        return value;
+    }
+    
+    template<typename T>
+    void read(T& value) {
+        value = read<T>();
+    }
+    
+    // Reads a bool written by write(); any byte other than 0 or 1 fails
+    bool readBool() {
+        uint8_t value = read<uint8_t>();
+        if (value > 1) {
+            m_failed = true;
+            return false;
+        }
+        return value != 0;
+    }
+    
+    void readBytes(void* out, size_t size) {
+        if (m_failed || size > m_size - m_offset) {
+            std::memset(out, 0, size);
+            m_failed = true;
+            return;
+        }
+        std::memcpy(out, m_data + m_offset, size);
+        m_offset += size;
+    }
+    
+    // Reject the rest of the block, e.g. after reading an invalid tag
+    void fail() { m_failed = true; }
+    
+    size_t getOffset() const { return m_offset; }
+    size_t getRemaining() const { return m_size - m_offset; }
+    bool failed() const { return m_failed; }
+
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_offset;
+    bool m_failed;
+};
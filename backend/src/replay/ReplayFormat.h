@@ -0,0 +1,56 @@
+// backend/src/replay/ReplayFormat.h
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+// On-disk layout of a recorded match:
+//
+//   ReplayHeader
+//   keyframe blobs      Game::saveState() output, written as recorded
+//   ReplayTick[]        one record per simulated tick
+//   ReplayKeyframe[]    index of the blobs, sorted by tick
+//
+// A keyframe for tick N holds the state before tick N is simulated, so
+// seeking loads the nearest keyframe at or before the target and replays
+// the ticks in between.
+
+constexpr uint32_t kReplayMagic = 0x50524744; // "DGRP"
+
+// Bump when the header, tick records or Game state layout change
+constexpr uint32_t kReplayVersion = 8;
+
+// Ten seconds at 60 ticks per second
+constexpr uint32_t kDefaultKeyframeInterval = 600;
+
+struct ReplayHeader {
+    uint32_t magic = kReplayMagic;
+    uint32_t version = kReplayVersion;
+    uint64_t seed = 0;               // Seed the match was initialized with
+    float worldWidth = 0.0f;
+    float worldHeight = 0.0f;
+    uint32_t tickCount = 0;
+    uint32_t keyframeInterval = 0;
+    uint32_t keyframeCount = 0;
+    uint32_t reserved = 0;
+    uint64_t ticksOffset = 0;        // File offset of ReplayTick[tickCount]
+    uint64_t keyframesOffset = 0;    // File offset of ReplayKeyframe[keyframeCount]
+};
+
+// Player input held during a tick, one bit per PlayerInput
+struct ReplayTick {
+    uint8_t inputMask = 0;
+    uint8_t reserved[3] = {0, 0, 0};
+    float deltaTime = 0.0f;
+};
+
+struct ReplayKeyframe {
+    uint32_t tick = 0;
+    uint32_t size = 0;
+    uint64_t offset = 0;
+};
+
+static_assert(sizeof(ReplayHeader) == 56, "ReplayHeader layout changed; bump kReplayVersion");
+static_assert(sizeof(ReplayTick) == 8, "ReplayTick layout changed; bump kReplayVersion");
+static_assert(sizeof(ReplayKeyframe) == 16, "ReplayKeyframe layout changed; bump kReplayVersion");
+static_assert(std::is_trivially_copyable<ReplayHeader>::value, "ReplayHeader must be plain data");
@@ -0,0 +1,191 @@
+// backend/src/replay/ReplayPlayer.cpp
+#include "ReplayPlayer.h"
+#include "BinaryStream.h"
+#include "../Game.h"
+#include <algorithm>
+#include <cstdio>
+
+#if !defined(__EMSCRIPTEN__) && !defined(_WIN32)
+#define DODGEBALL_REPLAY_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define DODGEBALL_REPLAY_MMAP 0
+#endif
+
+ReplayPlayer::ReplayPlayer()
+    : m_data(nullptr),
+      m_size(0),
+      m_mapping(nullptr),
+      m_ticks(nullptr),
+      m_keyframes(nullptr),
+      m_tick(0),
+      m_positioned(nullptr) {
+}
+
+ReplayPlayer::~ReplayPlayer() {
+    close();
+}
+
+bool ReplayPlayer::open(const std::string& path) {
+    close();
+
+#if DODGEBALL_REPLAY_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    
+    void* mapping = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    
+    m_mapping = mapping;
+    m_data = static_cast<const uint8_t*>(mapping);
+    m_size = static_cast<size_t>(info.st_size);
+#else
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+    
+    long size = -1;
+    if (std::fseek(file, 0, SEEK_END) == 0) {
+        size = std::ftell(file);
+    }
+    if (size > 0 && std::fseek(file, 0, SEEK_SET) == 0) {
+        m_fileContents.resize(static_cast<size_t>(size));
+        if (std::fread(m_fileContents.data(), 1, m_fileContents.size(), file) != m_fileContents.size()) {
+            m_fileContents.clear();
+        }
+    }
+    std::fclose(file);
+    
+    if (m_fileContents.empty()) {
+        return false;
+    }
+    m_data = m_fileContents.data();
+    m_size = m_fileContents.size();
+#endif
+    
+    if (!validate()) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void ReplayPlayer::close() {
+#if DODGEBALL_REPLAY_MMAP
+    if (m_mapping) {
+        ::munmap(m_mapping, m_size);
+    }
+#endif
+    m_mapping = nullptr;
+    m_fileContents.clear();
+    m_fileContents.shrink_to_fit();
+    m_data = nullptr;
+    m_size = 0;
+    m_header = ReplayHeader();
+    m_ticks = nullptr;
+    m_keyframes = nullptr;
+    m_tick = 0;
+    m_positioned = nullptr;
+}
+
+bool ReplayPlayer::validate() {
+    BinaryReader reader(m_data, m_size);
+    m_header = reader.read<ReplayHeader>();
+    if (reader.failed() || m_header.magic != kReplayMagic || m_header.version != kReplayVersion) {
+        return false;
+    }
+    
+    // Both tables must lie inside the file and be aligned for direct access
+    uint64_t ticksSize = static_cast<uint64_t>(m_header.tickCount) * sizeof(ReplayTick);
+    uint64_t keyframesSize = static_cast<uint64_t>(m_header.keyframeCount) * sizeof(ReplayKeyframe);
+    if (m_header.ticksOffset % alignof(ReplayTick) != 0 ||
+        m_header.keyframesOffset % alignof(ReplayKeyframe) != 0 ||
+        m_header.ticksOffset > m_size || ticksSize > m_size - m_header.ticksOffset ||
+        m_header.keyframesOffset > m_size || keyframesSize > m_size - m_header.keyframesOffset) {
+        return false;
+    }
+    
+    m_ticks = reinterpret_cast<const ReplayTick*>(m_data + m_header.ticksOffset);
+    m_keyframes = reinterpret_cast<const ReplayKeyframe*>(m_data + m_header.keyframesOffset);
+    
+    // Seeking needs a keyframe at tick 0 and the index sorted by tick
+    if (m_header.keyframeCount == 0 || m_keyframes[0].tick != 0) {
+        return false;
+    }
+    for (uint32_t i = 0; i < m_header.keyframeCount; ++i) {
+        const ReplayKeyframe& keyframe = m_keyframes[i];
+        if (keyframe.offset > m_size || keyframe.size > m_size - keyframe.offset ||
+            keyframe.tick > m_header.tickCount ||
+            (i > 0 && keyframe.tick <= m_keyframes[i - 1].tick)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const ReplayKeyframe* ReplayPlayer::findKeyframe(uint32_t tick) const {
+    // Last keyframe whose tick is not after the target
+    const ReplayKeyframe* end = m_keyframes + m_header.keyframeCount;
+    const ReplayKeyframe* next = std::upper_bound(m_keyframes, end, tick,
+        [](uint32_t value, const ReplayKeyframe& keyframe) {
+            return value < keyframe.tick;
+        });
+    return next - 1;
+}
+
+bool ReplayPlayer::seek(Game& game, uint32_t tick) {
+    if (!isOpen()) {
+        return false;
+    }
+    tick = std::min(tick, m_header.tickCount);
+    
+    // Keep simulating forward when this game is the one positioned, the
+    // target is ahead of it and no keyframe lies in between
+    const ReplayKeyframe* keyframe = findKeyframe(tick);
+    bool continueFromHere = m_positioned == &game && m_tick <= tick && keyframe->tick <= m_tick;
+    
+    if (!continueFromHere) {
+        BinaryReader reader(m_data + keyframe->offset, keyframe->size);
+        game.setDeterministic(true);
+        if (!game.loadState(reader)) {
+            m_positioned = nullptr;
+            return false;
+        }
+        m_tick = keyframe->tick;
+        m_positioned = &game;
+    }
+    
+    while (m_tick < tick) {
+        step(game);
+    }
+    return true;
+}
+
+bool ReplayPlayer::step(Game& game) {
+    if (m_positioned != &game || m_tick >= m_header.tickCount) {
+        return false;
+    }
+    
+    const ReplayTick& tick = m_ticks[m_tick];
+    if (Player* player = game.getPlayer()) {
+        player->setInputMask(tick.inputMask);
+    }
+    game.update(tick.deltaTime);
+    m_tick++;
+    return true;
+}
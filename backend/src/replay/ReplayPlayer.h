@@ -0,0 +1,59 @@
+// backend/src/replay/ReplayPlayer.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "ReplayFormat.h"
+
+class Game;
+
+// Plays back a recorded match. Native builds map the file read-only, so
+// opening a long replay costs nothing until a keyframe is touched;
+// WebAssembly builds read it into memory instead.
+//
+// To profile one stretch of a match, seek() to its first tick and step()
+// through it with profiling enabled.
+class ReplayPlayer {
+public:
+    ReplayPlayer();
+    ~ReplayPlayer();
+    
+    ReplayPlayer(const ReplayPlayer&) = delete;
+    ReplayPlayer& operator=(const ReplayPlayer&) = delete;
+    
+    // Validates the header, tick records and keyframe index
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return m_data != nullptr; }
+    
+    // Restore the nearest keyframe at or before tick and simulate up to it.
+    // Afterwards the game holds the state before that tick is simulated.
+    // A game other than the one last positioned always restores a keyframe.
+    bool seek(Game& game, uint32_t tick);
+    
+    // Apply the next recorded input and advance the game one tick.
+    // Returns false at the end of the replay, or if game is not the one
+    // the last seek() positioned.
+    bool step(Game& game);
+    
+    uint32_t getTick() const { return m_tick; }
+    uint32_t getTickCount() const { return m_header.tickCount; }
+    const ReplayHeader& getHeader() const { return m_header; }
+
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+    void* m_mapping;
+    std::vector<uint8_t> m_fileContents;
+    
+    ReplayHeader m_header;
+    const ReplayTick* m_ticks;
+    const ReplayKeyframe* m_keyframes;
+    uint32_t m_tick;
+    const Game* m_positioned;    // Game the last seek() left at m_tick
+    
+    bool validate();
+    const ReplayKeyframe* findKeyframe(uint32_t tick) const;
+};
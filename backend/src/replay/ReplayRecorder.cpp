@@ -0,0 +1,111 @@
+// backend/src/replay/ReplayRecorder.cpp
+#include "ReplayRecorder.h"
+#include "BinaryStream.h"
+#include "../Game.h"
+
+ReplayRecorder::ReplayRecorder()
+    : m_file(nullptr),
+      m_fileOffset(0),
+      m_writeFailed(false) {
+}
+
+ReplayRecorder::~ReplayRecorder() {
+    finish();
+}
+
+bool ReplayRecorder::begin(const std::string& path, Game& game, uint32_t keyframeInterval) {
+    finish();
+    
+    m_file = std::fopen(path.c_str(), "wb");
+    if (!m_file) {
+        return false;
+    }
+    
+    game.setDeterministic(true);
+    
+    m_header = ReplayHeader();
+    m_header.seed = game.getSeed();
+    m_header.keyframeInterval = keyframeInterval > 0 ? keyframeInterval : kDefaultKeyframeInterval;
+    m_ticks.clear();
+    m_keyframes.clear();
+    m_fileOffset = 0;
+    m_writeFailed = false;
+    
+    // Placeholder; finish() rewrites it once the offsets are known
+    writeBytes(&m_header, sizeof(m_header));
+    return !m_writeFailed;
+}
+
+void ReplayRecorder::recordTick(const Game& game, float deltaTime) {
+    if (!m_file) {
+        return;
+    }
+    
+    // Keyframes capture the state before the tick they are indexed by
+    if (m_ticks.size() % m_header.keyframeInterval == 0) {
+        writeKeyframe(game);
+    }
+    
+    ReplayTick tick;
+    tick.inputMask = game.getPlayer() ? game.getPlayer()->getInputMask() : 0;
+    tick.deltaTime = deltaTime;
+    m_ticks.push_back(tick);
+}
+
+void ReplayRecorder::writeKeyframe(const Game& game) {
+    m_stateBuffer.clear();
+    BinaryWriter writer(m_stateBuffer);
+    game.saveState(writer);
+    
+    ReplayKeyframe keyframe;
+    keyframe.tick = static_cast<uint32_t>(m_ticks.size());
+    keyframe.size = static_cast<uint32_t>(m_stateBuffer.size());
+    keyframe.offset = m_fileOffset;
+    m_keyframes.push_back(keyframe);
+    
+    // The first keyframe also fixes the world size for the header
+    if (m_keyframes.size() == 1) {
+        m_header.worldWidth = game.getWorldWidth();
+        m_header.worldHeight = game.getWorldHeight();
+    }
+    
+    writeBytes(m_stateBuffer.data(), m_stateBuffer.size());
+}
+
+bool ReplayRecorder::finish() {
+    if (!m_file) {
+        return false;
+    }
+    
+    m_header.tickCount = static_cast<uint32_t>(m_ticks.size());
+    m_header.keyframeCount = static_cast<uint32_t>(m_keyframes.size());
+    
+    // Align the tables so playback can use them in place
+    const uint8_t padding[8] = {};
+    writeBytes(padding, static_cast<size_t>((8 - m_fileOffset % 8) % 8));
+    m_header.ticksOffset = m_fileOffset;
+    writeBytes(m_ticks.data(), m_ticks.size() * sizeof(ReplayTick));
+    m_header.keyframesOffset = m_fileOffset;
+    writeBytes(m_keyframes.data(), m_keyframes.size() * sizeof(ReplayKeyframe));
+    
+    if (std::fseek(m_file, 0, SEEK_SET) != 0 ||
+        std::fwrite(&m_header, sizeof(m_header), 1, m_file) != 1) {
+        m_writeFailed = true;
+    }
+    if (std::fclose(m_file) != 0) {
+        m_writeFailed = true;
+    }
+    m_file = nullptr;
+    
+    return !m_writeFailed;
+}
+
+void ReplayRecorder::writeBytes(const void* data, size_t size) {
+    if (size == 0) {
+        return;
+    }
+    if (std::fwrite(data, 1, size, m_file) != size) {
+        m_writeFailed = true;
+    }
+    m_fileOffset += size;
+}
@@ -0,0 +1,47 @@
+// backend/src/replay/ReplayRecorder.h
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "ReplayFormat.h"
+
+class Game;
+
+// Records a match into the replay format. Keyframe blobs are streamed to
+// the file as they are taken; tick records are kept in memory (8 bytes a
+// tick, under 1 MB for 30 minutes at 60 Hz) and written by finish().
+//
+// Call recordTick() once per tick, after that tick's input has been
+// applied and before Game::update(). The game is switched to deterministic
+// mode while recording.
+class ReplayRecorder {
+public:
+    ReplayRecorder();
+    ~ReplayRecorder();
+    
+    ReplayRecorder(const ReplayRecorder&) = delete;
+    ReplayRecorder& operator=(const ReplayRecorder&) = delete;
+    
+    bool begin(const std::string& path, Game& game, uint32_t keyframeInterval = kDefaultKeyframeInterval);
+    void recordTick(const Game& game, float deltaTime);
+    
+    // Writes the tick records and index and closes the file
+    bool finish();
+    
+    bool isRecording() const { return m_file != nullptr; }
+    uint32_t getTickCount() const { return static_cast<uint32_t>(m_ticks.size()); }
+
+private:
+    std::FILE* m_file;
+    ReplayHeader m_header;
+    std::vector<ReplayTick> m_ticks;
+    std::vector<ReplayKeyframe> m_keyframes;
+    std::vector<uint8_t> m_stateBuffer;
+    uint64_t m_fileOffset;
+    bool m_writeFailed;
+    
+    void writeKeyframe(const Game& game);
+    void writeBytes(const void* data, size_t size);
+};
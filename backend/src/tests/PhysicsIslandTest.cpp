@@ -0,0 +1,87 @@
+// backend/src/tests/PhysicsIslandTest.cpp
+// Parallel island solving: many separate piles of circles, stepped with
+// different worker counts, must end in byte-identical transforms.
+#include "TestHarness.h"
+#include "../Entity.h"
+#include "../physics/PhysicsWorld.h"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+const float kTickLength = 1.0f / 60.0f;
+const int kPiles = 16;
+const int kCirclesPerPile = 40;
+const int kSteps = 240;
+
+struct IslandRun {
+    uint64_t hash = 0;
+    PhysicsStats stats;
+};
+
+// FNV-1a over every slot's position and velocity
+uint64_t hashTransforms(const TransformStore& transforms) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (int slot = 0; slot < transforms.getCapacity(); ++slot) {
+        Vector2 values[2] = {transforms.getPosition(slot), transforms.getVelocity(slot)};
+        unsigned char bytes[sizeof(values)];
+        std::memcpy(bytes, values, sizeof(values));
+        for (unsigned char byte : bytes) {
+            hash = (hash ^ byte) * 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+IslandRun runPiles(int workerCount) {
+    TransformStore transforms;
+    PhysicsWorld world(500.0f);
+    world.setTransforms(&transforms);
+    world.setWorkerCount(workerCount);
+    
+    // One static ground shared by every pile; static bodies join no island,
+    // so no island spans two piles
+    std::vector<std::unique_ptr<Entity>> entities;
+    const float groundRadius = 100000.0f;
+    entities.emplace_back(new Entity(transforms, EntityType::DRONE, Vector2(0.0f, 1000.0f + groundRadius), groundRadius));
+    world.createBody(entities.back().get(), false);
+    for (int pile = 0; pile < kPiles; ++pile) {
+        for (int i = 0; i < kCirclesPerPile; ++i) {
+            Vector2 position(pile * 200.0f + (i % 5) * 19.0f + 0.3f * i, 990.0f - 19.0f * (i / 5));
+            entities.emplace_back(new Entity(transforms, EntityType::DRONE, position, 10.0f));
+            world.createBody(entities.back().get(), true);
+        }
+    }
+    
+    for (int step = 0; step < kSteps; ++step) {
+        world.update(kTickLength);
+        transforms.integrate(kTickLength);
+    }
+    
+    IslandRun run;
+    run.hash = hashTransforms(transforms);
+    run.stats = world.getStats();
+    return run;
+}
+
+void testSameResultOnAnyWorkerCount() {
+    IslandRun serial = runPiles(0);
+    TEST_CHECK(serial.stats.islands >= kPiles);
+    TEST_CHECK(!serial.stats.parallel);
+    
+    const int workerCounts[] = {1, 3, 7};
+    for (int workers : workerCounts) {
+        IslandRun run = runPiles(workers);
+        TEST_CHECK(run.stats.parallel);
+        TEST_CHECK(run.stats.islands == serial.stats.islands);
+        TEST_CHECK(run.stats.contacts == serial.stats.contacts);
+        TEST_CHECK(run.hash == serial.hash);
+    }
+}
+}
+
+int main() {
+    TEST_RUN(testSameResultOnAnyWorkerCount);
+    return test::failures();
+}
@@ -0,0 +1,110 @@
+// backend/src/tests/PhysicsSolverTest.cpp
+// Contact solver: a stack of circles resting on static ground must settle,
+// and warm starting must settle it in fewer velocity iterations than
+// solving every step from zero.
+#include "TestHarness.h"
+#include "../Entity.h"
+#include "../physics/PhysicsWorld.h"
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace {
+const float kTickLength = 1.0f / 60.0f;
+const float kGroundTop = 1000.0f;
+const float kRadius = 10.0f;
+const int kStackHeight = 6;
+const int kSteps = 600;
+const int kSettledFrom = 300;
+
+struct StackResult {
+    float earlyResidual = 0.0f;       // Mean over the first steps in contact
+    float settledResidual = 0.0f;     // Mean over the settled steps
+    float settledIterations = 0.0f;   // Mean velocity iterations run
+    float topHeight = 0.0f;           // Top circle's centre above the ground
+    float maxSpeed = 0.0f;
+    int warmStarted = 0;
+    float maxPenetration = 0.0f;
+};
+
+StackResult runStack(bool warmStarting) {
+    TransformStore transforms;
+    PhysicsWorld world(500.0f);
+    world.setTransforms(&transforms);
+    world.setIterations(8, 3);
+    world.setVelocityTolerance(0.01f);
+    world.setWarmStarting(warmStarting);
+    world.setWorkerCount(0);
+    
+    BodyMaterial material;
+    material.restitution = 0.0f;
+    
+    // A huge static circle as the ground, then circles dropped just above it
+    std::vector<std::unique_ptr<Entity>> entities;
+    const float groundRadius = 1000.0f;
+    entities.emplace_back(new Entity(transforms, EntityType::DRONE, Vector2(400.0f, kGroundTop + groundRadius), groundRadius));
+    world.createBody(entities.back().get(), false, material);
+    for (int i = 0; i < kStackHeight; ++i) {
+        Vector2 position(400.0f + 0.1f * i, kGroundTop - kRadius - 20.5f * i);
+        entities.emplace_back(new Entity(transforms, EntityType::DRONE, position, kRadius));
+        world.createBody(entities.back().get(), true, material);
+    }
+    
+    StackResult result;
+    int earlySteps = 0;
+    for (int step = 0; step < kSteps; ++step) {
+        world.update(kTickLength);
+        transforms.integrate(kTickLength);
+        
+        const PhysicsStats& stats = world.getStats();
+        if (stats.contacts == kStackHeight && earlySteps < 30) {
+            result.earlyResidual += stats.residual;
+            earlySteps++;
+        }
+        if (step >= kSettledFrom) {
+            result.settledResidual += stats.residual;
+            result.settledIterations += static_cast<float>(stats.velocityIterations);
+        }
+    }
+    
+    int settledSteps = kSteps - kSettledFrom;
+    result.earlyResidual /= static_cast<float>(earlySteps > 0 ? earlySteps : 1);
+    result.settledResidual /= static_cast<float>(settledSteps);
+    result.settledIterations /= static_cast<float>(settledSteps);
+    result.topHeight = kGroundTop - entities.back()->getPosition().y;
+    for (size_t i = 1; i < entities.size(); ++i) {
+        result.maxSpeed = std::max(result.maxSpeed, entities[i]->getVelocity().length());
+    }
+    result.warmStarted = world.getStats().warmStarted;
+    result.maxPenetration = world.getStats().maxPenetration;
+    return result;
+}
+
+void testStackSettles() {
+    StackResult warm = runStack(true);
+    
+    // Every contact carried over, the stack at rest at about its full height
+    TEST_CHECK(warm.warmStarted == kStackHeight);
+    TEST_CHECK(warm.maxSpeed < 1.0f);
+    TEST_CHECK(std::fabs(warm.topHeight - (kRadius + 2.0f * kRadius * (kStackHeight - 1))) < 2.0f);
+    TEST_CHECK(warm.maxPenetration < 1.0f);
+    
+    // The residual falls as the stack comes to rest
+    TEST_CHECK(warm.settledResidual < warm.earlyResidual);
+}
+
+void testWarmStartingConverges() {
+    StackResult warm = runStack(true);
+    StackResult cold = runStack(false);
+    
+    TEST_CHECK(cold.warmStarted == 0);
+    TEST_CHECK(warm.settledIterations < cold.settledIterations);
+    TEST_CHECK(warm.settledResidual < cold.settledResidual);
+}
+}
+
+int main() {
+    TEST_RUN(testStackSettles);
+    TEST_RUN(testWarmStartingConverges);
+    return test::failures();
+}
@@ -0,0 +1,170 @@
+// backend/src/tests/RasterizerGoldenTest.cpp
+// Golden frames, rendered headlessly and compared with the frames checked
+// in under tests/golden:
+// - scene_*: a fixed, hand-built draw list. Only the rasterizer is
+//   involved, so these must match byte for byte.
+// - seeded_*: the end of a seeded 240-tick match. That is float
+//   simulation, which may round differently on other compilers or CPUs,
+//   so a few percent of the pixels may differ (see kSeededTolerance).
+// On a mismatch the new frame is written to the working directory as
+// <name>.actual for inspection. After an intended change to simulation
+// or rendering, regenerate the goldens with:
+//     rasterizer_golden_test <golden dir> --update
+#include "TestHarness.h"
+#include "../Game.h"
+#include "../render/SoftwareRasterizer.h"
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+const int kTicks = 240;
+const float kTickLength = 1.0f / 60.0f;
+
+// Share of a seeded frame's pixels that may differ from its golden. A
+// drifted entity moves its edge by a pixel or so; a diverged match
+// moves whole circles and fails.
+const double kSeededTolerance = 0.02;
+
+std::string g_goldenDir = "golden";
+bool g_update = false;
+
+// The same match every run: fixed seed, input changing on a fixed schedule
+void playMatch(Game& game) {
+    game.setDeterministic(true);
+    game.setSeed(3);
+    game.initialize();
+    
+    const uint8_t inputs[] = {
+        static_cast<uint8_t>(Player::inputBit(PlayerInput::UP) | Player::inputBit(PlayerInput::FIRE)),
+        static_cast<uint8_t>(Player::inputBit(PlayerInput::LEFT)),
+        static_cast<uint8_t>(Player::inputBit(PlayerInput::DOWN) | Player::inputBit(PlayerInput::RIGHT) |
+                             Player::inputBit(PlayerInput::FIRE)),
+    };
+    for (int tick = 0; tick < kTicks && game.getState() == GameState::PLAYING; ++tick) {
+        game.getPlayer()->setInputMask(inputs[(tick / 40) % 3]);
+        game.update(kTickLength);
+    }
+}
+
+// Every type, overlapping groups (drawn in GameCanvas order), circles
+// cut by each edge of the 800x600 world, one entirely outside it and
+// sub-pixel radii
+void buildScene(DrawList& list) {
+    list.clear();
+    list.add(EntityType::DRONE, {1, 120.0f, 90.0f, 40.0f});
+    list.add(EntityType::DRONE, {2, 700.5f, 480.25f, 64.0f});
+    list.add(EntityType::DRONE, {3, 400.0f, -20.0f, 50.0f});
+    list.add(EntityType::PLAYER, {4, 400.0f, 300.0f, 30.0f});
+    list.add(EntityType::POWERUP, {5, 140.0f, 110.0f, 24.0f});
+    list.add(EntityType::POWERUP, {6, 790.0f, 300.0f, 36.0f});
+    list.add(EntityType::PROJECTILE, {-1, 410.0f, 290.0f, 5.0f});
+    list.add(EntityType::PROJECTILE, {-1, -10.0f, 580.0f, 30.0f});
+    list.add(EntityType::PROJECTILE, {-1, 250.3f, 450.7f, 2.4f});
+    list.add(EntityType::PROJECTILE, {-1, 900.0f, 100.0f, 20.0f});
+    list.add(EntityType::DRONE, {7, 610.0f, 160.0f, 3.5f});
+}
+
+void checkGolden(const SoftwareRasterizer& frame, const std::string& name, size_t maxDifferent = 0) {
+    std::string goldenPath = g_goldenDir + "/" + name;
+    if (g_update) {
+        TEST_CHECK(frame.savePnm(goldenPath));
+        return;
+    }
+    
+    std::vector<uint8_t> golden;
+    int width = 0;
+    int height = 0;
+    PixelFormat format = PixelFormat::GRAY8;
+    bool loaded = SoftwareRasterizer::loadPnm(goldenPath, golden, width, height, format);
+    bool sameShape = loaded && width == frame.getWidth() && height == frame.getHeight() && format == frame.getFormat();
+    TEST_CHECK(sameShape);
+    
+    size_t different = sameShape
+        ? SoftwareRasterizer::countDifferentPixels(golden.data(), frame.getPixels(),
+                                                   static_cast<size_t>(width) * height, frame.getBytesPerPixel())
+        : static_cast<size_t>(frame.getWidth()) * frame.getHeight();
+    if (different > maxDifferent) {
+        std::printf("%s: %zu pixels differ (%zu allowed); wrote %s.actual\n",
+                    name.c_str(), different, maxDifferent, name.c_str());
+        frame.savePnm(name + ".actual");
+    }
+    TEST_CHECK(different <= maxDifferent);
+}
+
+size_t seededTolerance(const SoftwareRasterizer& frame) {
+    return static_cast<size_t>(kSeededTolerance * frame.getWidth() * frame.getHeight());
+}
+
+void testFixedSceneFrames() {
+    DrawList list;
+    buildScene(list);
+    TEST_CHECK(list.getHeader().count == 11);
+    TEST_CHECK(list.count(EntityType::DRONE) == 4);
+    TEST_CHECK(list.begin(EntityType::DRONE)[3].id == 7);
+    
+    // An observation-sized gray frame and a larger colour one
+    SoftwareRasterizer gray(84, 84);
+    gray.render(list);
+    checkGolden(gray, "scene_84x84.pgm");
+    
+    SoftwareRasterizer rgb(160, 120, PixelFormat::RGB8);
+    rgb.setBackground(16, 24, 32);
+    rgb.render(list);
+    checkGolden(rgb, "scene_160x120.ppm");
+}
+
+void testSeededMatchFrames() {
+    Game game;
+    playMatch(game);
+    TEST_CHECK(game.getEntities().size() > 1);
+    
+    SoftwareRasterizer gray(84, 84);
+    gray.render(game);
+    checkGolden(gray, "seeded_84x84.pgm", seededTolerance(gray));
+    
+    SoftwareRasterizer rgb(160, 120, PixelFormat::RGB8);
+    rgb.render(game);
+    checkGolden(rgb, "seeded_160x120.ppm", seededTolerance(rgb));
+}
+
+void testRenderIsRepeatable() {
+    Game game;
+    playMatch(game);
+    SoftwareRasterizer first(84, 84);
+    SoftwareRasterizer second(84, 84);
+    first.render(game);
+    second.render(game);
+    second.render(game);
+    TEST_CHECK(std::memcmp(first.getPixels(), second.getPixels(), first.getSize()) == 0);
+}
+
+void testEmptyListIsBackground() {
+    SoftwareRasterizer frame(33, 17, PixelFormat::RGB8);
+    frame.setBackground(10, 20, 30);
+    frame.render(DrawList());
+    
+    bool allBackground = true;
+    for (size_t i = 0; i < frame.getSize(); i += 3) {
+        const uint8_t* pixel = frame.getPixels() + i;
+        allBackground = allBackground && pixel[0] == 10 && pixel[1] == 20 && pixel[2] == 30;
+    }
+    TEST_CHECK(allBackground);
+}
+}
+
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--update") == 0) {
+            g_update = true;
+        } else {
+            g_goldenDir = argv[i];
+        }
+    }
+    
+    TEST_RUN(testFixedSceneFrames);
+    TEST_RUN(testSeededMatchFrames);
+    TEST_RUN(testRenderIsRepeatable);
+    TEST_RUN(testEmptyListIsBackground);
+    return test::failures();
+}
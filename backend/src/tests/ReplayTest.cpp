@@ -0,0 +1,184 @@
+// backend/src/tests/ReplayTest.cpp
+// Record/playback determinism: a recorded match, restored from any
+// keyframe and replayed, must reach byte-identical game state.
+// Build with -DDODGEBALL_BUILD_TESTS=ON and run through ctest.
+#include "TestHarness.h"
+#include "../Game.h"
+#include "../engine/Random.h"
+#include "../replay/BinaryStream.h"
+#include "../replay/ReplayPlayer.h"
+#include "../replay/ReplayRecorder.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace {
+const char* const kReplayPath = "replay_test.replay";
+const char* const kTruncatedPath = "replay_test_truncated.replay";
+const uint32_t kTicks = 1800;
+const uint32_t kKeyframeInterval = 300;
+const uint32_t kSnapshotTick = 700;
+
+std::vector<uint8_t> snapshot(const Game& game) {
+    std::vector<uint8_t> state;
+    BinaryWriter writer(state);
+    game.saveState(writer);
+    return state;
+}
+
+// A seeded match with changing input and uneven time steps, recorded to
+// kReplayPath. Returns the state before kSnapshotTick and at the end.
+bool recordMatch(std::vector<uint8_t>& atSnapshot, std::vector<uint8_t>& atEnd) {
+    Game game;
+    game.setWorldSize(1600.0f, 1200.0f);
+    game.setSeed(42);
+    game.initialize();
+    
+    ReplayRecorder recorder;
+    if (!recorder.begin(kReplayPath, game, kKeyframeInterval)) {
+        return false;
+    }
+    
+    Random input(7);
+    for (uint32_t tick = 0; tick < kTicks; ++tick) {
+        if (tick == kSnapshotTick) {
+            atSnapshot = snapshot(game);
+        }
+        if (tick % 20 == 0 && game.getPlayer()) {
+            game.getPlayer()->setInputMask(static_cast<uint8_t>(input.nextU32() & 0x1f));
+        }
+        float deltaTime = tick % 3 == 0 ? 0.017f : 0.016f;
+        recorder.recordTick(game, deltaTime);
+        game.update(deltaTime);
+    }
+    
+    atEnd = snapshot(game);
+    return recorder.finish() && recorder.getTickCount() == kTicks;
+}
+
+void testSeekAndPlayback() {
+    std::vector<uint8_t> atSnapshot;
+    std::vector<uint8_t> atEnd;
+    TEST_CHECK(recordMatch(atSnapshot, atEnd));
+    
+    ReplayPlayer player;
+    TEST_CHECK(player.open(kReplayPath));
+    TEST_CHECK(player.getTickCount() == kTicks);
+    TEST_CHECK(player.getHeader().seed == 42);
+    
+    // From the keyframe before the snapshot, then on to the end
+    Game game;
+    TEST_CHECK(player.seek(game, kSnapshotTick));
+    TEST_CHECK(player.getTick() == kSnapshotTick);
+    TEST_CHECK(snapshot(game) == atSnapshot);
+    while (player.step(game)) {
+    }
+    TEST_CHECK(snapshot(game) == atEnd);
+    
+    // Backwards, then the whole match from its first tick in a fresh game
+    TEST_CHECK(player.seek(game, kSnapshotTick));
+    TEST_CHECK(snapshot(game) == atSnapshot);
+    Game fresh;
+    TEST_CHECK(player.seek(fresh, 0));
+    while (player.step(fresh)) {
+    }
+    TEST_CHECK(snapshot(fresh) == atEnd);
+    
+    // Another game is restored from a keyframe, not stepped on from its own state
+    TEST_CHECK(player.seek(game, kSnapshotTick - 1));
+    TEST_CHECK(!player.step(fresh));
+    TEST_CHECK(player.seek(fresh, kSnapshotTick));
+    TEST_CHECK(snapshot(fresh) == atSnapshot);
+}
+
+void testRejectsTruncatedFile() {
+    std::ifstream in(kReplayPath, std::ios::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    TEST_CHECK(bytes.size() > 64);
+    
+    std::ofstream out(kTruncatedPath, std::ios::binary);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() / 2));
+    out.close();
+    
+    ReplayPlayer player;
+    TEST_CHECK(!player.open(kTruncatedPath));
+}
+
+bool rejected(Game& game, const std::vector<uint8_t>& state) {
+    BinaryReader reader(state.data(), state.size());
+    return !game.loadState(reader) && game.getState() == GameState::MENU &&
+           game.getEntities().empty() && !game.getPlayer();
+}
+
+// Out-of-range enum tags and bool bytes in a keyframe must fail the load
+// rather than index a drone group or archetype table
+void testRejectsCorruptKeyframe() {
+    Game game;
+    game.setWorldSize(1600.0f, 1200.0f);
+    game.setSeed(42);
+    game.initialize();
+    for (int tick = 0; tick < 600; ++tick) {
+        game.update(0.016f);
+    }
+    std::vector<uint8_t> state = snapshot(game);
+    
+    const Entity* drone = nullptr;
+    for (const auto& entity : game.getEntities()) {
+        if (entity->getType() == EntityType::DRONE) {
+            drone = entity.get();
+            break;
+        }
+    }
+    TEST_CHECK(drone != nullptr);
+    if (!drone) {
+        return;
+    }
+    
+    // The drone's record is stored whole; its last fields are the type tag,
+    // two floats and the hasThought flag
+    std::vector<uint8_t> record;
+    BinaryWriter writer(record);
+    drone->saveState(writer);
+    auto found = std::search(state.begin(), state.end(), record.begin(), record.end());
+    TEST_CHECK(found != state.end());
+    if (found == state.end()) {
+        return;
+    }
+    size_t hasThoughtOffset = static_cast<size_t>(found - state.begin()) + record.size() - 1;
+    size_t typeOffset = hasThoughtOffset - 2 * sizeof(float) - 1;
+    
+    Game loaded;
+    std::vector<uint8_t> corrupt = state;
+    corrupt[typeOffset] = kDroneTypeCount;
+    TEST_CHECK(rejected(loaded, corrupt));
+    corrupt = state;
+    corrupt[hasThoughtOffset] = 2;
+    TEST_CHECK(rejected(loaded, corrupt));
+    
+    // The untouched state still loads into the same game
+    BinaryReader reader(state.data(), state.size());
+    TEST_CHECK(loaded.loadState(reader));
+    TEST_CHECK(snapshot(loaded) == state);
+    
+    // Whatever a single bad byte does, a failed load leaves an empty MENU game
+    for (size_t offset = 0; offset < state.size(); ++offset) {
+        corrupt = state;
+        corrupt[offset] = 0xff;
+        BinaryReader corruptReader(corrupt.data(), corrupt.size());
+        if (!loaded.loadState(corruptReader)) {
+            TEST_CHECK(loaded.getState() == GameState::MENU && loaded.getEntities().empty());
+        }
+    }
+}
+}
+
+int main() {
+    TEST_RUN(testSeekAndPlayback);
+    TEST_RUN(testRejectsTruncatedFile);
+    TEST_RUN(testRejectsCorruptKeyframe);
+    std::remove(kReplayPath);
+    std::remove(kTruncatedPath);
+    return test::failures();
+}
@@ -0,0 +1,30 @@
+// backend/src/tests/TestHarness.h
+#pragma once
+
+#include <cstdio>
+
+// Minimal checks for the native tests. A failed check is printed and
+// counted, and the test's main() returns the count, so ctest reports the
+// test as failed without stopping at the first problem.
+namespace test {
+inline int& failures() {
+    static int count = 0;
+    return count;
+}
+}
+
+#define TEST_CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            std::printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            test::failures()++; \
+        } \
+    } while (0)
+
+// Runs one test function and reports its name if any of its checks failed
+#define TEST_RUN(function) \
+    do { \
+        int failuresBefore = test::failures(); \
+        function(); \
+        std::printf("%s %s\n", test::failures() == failuresBefore ? "PASS" : "FAIL", #function); \
+    } while (0)
@@ -0,0 +1,224 @@
+// backend/src/tools/BroadphaseBench.cpp
+// Compares the uniform SpatialGrid (rebuilt every frame) against the
+// HierarchicalGrid (incremental updates) on moving circles of mixed sizes,
+// both with full pair traversal and with the persistent PairCache.
+// Build with -DDODGEBALL_BUILD_TOOLS=ON; run without arguments.
+#include "../collision/SpatialGrid.h"
+#include "../collision/HierarchicalGrid.h"
+#include "../collision/PairCache.h"
+#include "../engine/Random.h"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+const float kWorldWidth = 1600.0f;
+const float kWorldHeight = 1200.0f;
+const int kFrames = 300;
+const float kDeltaTime = 1.0f / 60.0f;
+
+struct Body {
+    float x;
+    float y;
+    float vx;
+    float vy;
+    float radius;
+};
+
+struct Workload {
+    const char* name;
+    int smallCount;      // Radius 5-15, like projectiles, power-ups and the player
+    int largeCount;
+    float largeMinRadius;
+    float largeMaxRadius;
+    float movingFraction;  // The rest stand still, like idle drones and power-ups
+};
+
+struct Result {
+    double msPerFrame = 0.0;
+    double testsPerFrame = 0.0;
+    double pairsPerFrame = 0.0;
+    double relinksPerFrame = 0.0;
+};
+
+std::vector<Body> makeBodies(const Workload& workload, uint64_t seed) {
+    Random random(seed);
+    std::vector<Body> bodies;
+    auto addBody = [&](float minRadius, float maxRadius, float speed) {
+        if (random.nextFloat() >= workload.movingFraction) {
+            speed = 0.0f;
+        }
+        Body body;
+        body.radius = minRadius + (maxRadius - minRadius) * random.nextFloat();
+        body.x = kWorldWidth * random.nextFloat();
+        body.y = kWorldHeight * random.nextFloat();
+        body.vx = speed * (random.nextFloat() * 2.0f - 1.0f);
+        body.vy = speed * (random.nextFloat() * 2.0f - 1.0f);
+        bodies.push_back(body);
+    };
+    for (int i = 0; i < workload.smallCount; ++i) {
+        addBody(5.0f, 15.0f, 200.0f);
+    }
+    for (int i = 0; i < workload.largeCount; ++i) {
+        addBody(workload.largeMinRadius, workload.largeMaxRadius, 40.0f);
+    }
+    return bodies;
+}
+
+void step(std::vector<Body>& bodies) {
+    for (Body& body : bodies) {
+        body.x += body.vx * kDeltaTime;
+        body.y += body.vy * kDeltaTime;
+        if (body.x < 0.0f || body.x > kWorldWidth) {
+            body.vx = -body.vx;
+        }
+        if (body.y < 0.0f || body.y > kWorldHeight) {
+            body.vy = -body.vy;
+        }
+    }
+}
+
+Result runUniform(const Workload& workload, float cellSize) {
+    std::vector<Body> bodies = makeBodies(workload, 1);
+    SpatialGrid grid(cellSize);
+    grid.setBounds(Vector2(0.0f, 0.0f), Vector2(kWorldWidth, kWorldHeight));
+    
+    Result result;
+    double totalMs = 0.0;
+    for (int frame = 0; frame < kFrames; ++frame) {
+        step(bodies);
+        
+        Clock::time_point start = Clock::now();
+        grid.clear();
+        for (size_t i = 0; i < bodies.size(); ++i) {
+            grid.insert(static_cast<int>(i), Vector2(bodies[i].x, bodies[i].y), bodies[i].radius);
+        }
+        grid.build();
+        int pairs = 0;
+        BroadphaseCounts counts = grid.forEachOverlappingPair([&pairs](int, int) { pairs++; });
+        totalMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        
+        result.testsPerFrame += counts.distanceTests;
+        result.pairsPerFrame += pairs;
+    }
+    
+    result.msPerFrame = totalMs / kFrames;
+    result.testsPerFrame /= kFrames;
+    result.pairsPerFrame /= kFrames;
+    return result;
+}
+
+Result runHierarchical(const Workload& workload, float baseCellSize) {
+    std::vector<Body> bodies = makeBodies(workload, 1);
+    HierarchicalGrid grid(baseCellSize);
+    grid.setBounds(Vector2(0.0f, 0.0f), Vector2(kWorldWidth, kWorldHeight));
+    
+    std::vector<int> handles;
+    for (size_t i = 0; i < bodies.size(); ++i) {
+        handles.push_back(grid.add(static_cast<int>(i), Vector2(bodies[i].x, bodies[i].y), bodies[i].radius));
+    }
+    
+    Result result;
+    double totalMs = 0.0;
+    for (int frame = 0; frame < kFrames; ++frame) {
+        step(bodies);
+        
+        Clock::time_point start = Clock::now();
+        grid.resetRelinks();
+        for (size_t i = 0; i < bodies.size(); ++i) {
+            grid.update(handles[i], static_cast<int>(i), Vector2(bodies[i].x, bodies[i].y), bodies[i].radius);
+        }
+        int pairs = 0;
+        BroadphaseCounts counts = grid.forEachOverlappingPair([&pairs](int, int) { pairs++; });
+        totalMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        
+        result.testsPerFrame += counts.distanceTests;
+        result.pairsPerFrame += pairs;
+        result.relinksPerFrame += grid.getRelinks();
+    }
+    
+    result.msPerFrame = totalMs / kFrames;
+    result.testsPerFrame /= kFrames;
+    result.pairsPerFrame /= kFrames;
+    result.relinksPerFrame /= kFrames;
+    return result;
+}
+
+Result runPairCache(const Workload& workload, float baseCellSize, float fatMargin) {
+    std::vector<Body> bodies = makeBodies(workload, 1);
+    HierarchicalGrid grid(baseCellSize);
+    grid.setBounds(Vector2(0.0f, 0.0f), Vector2(kWorldWidth, kWorldHeight));
+    grid.setFatMargin(fatMargin);
+    PairCache cache;
+    
+    std::vector<int> handles;
+    for (size_t i = 0; i < bodies.size(); ++i) {
+        handles.push_back(grid.add(static_cast<int>(i), Vector2(bodies[i].x, bodies[i].y), bodies[i].radius));
+    }
+    
+    Result result;
+    double totalMs = 0.0;
+    for (int frame = 0; frame < kFrames; ++frame) {
+        step(bodies);
+        
+        Clock::time_point start = Clock::now();
+        grid.resetRelinks();
+        for (size_t i = 0; i < bodies.size(); ++i) {
+            grid.update(handles[i], static_cast<int>(i), Vector2(bodies[i].x, bodies[i].y), bodies[i].radius);
+        }
+        cache.update(grid);
+        int pairs = 0;
+        for (const ContactEvent& event : cache.getEvents()) {
+            if (event.phase != ContactPhase::END) {
+                pairs++;
+            }
+        }
+        totalMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        
+        result.testsPerFrame += cache.getCounts().distanceTests;
+        result.pairsPerFrame += pairs;
+        result.relinksPerFrame += grid.getRelinks();
+    }
+    
+    result.msPerFrame = totalMs / kFrames;
+    result.testsPerFrame /= kFrames;
+    result.pairsPerFrame /= kFrames;
+    result.relinksPerFrame /= kFrames;
+    return result;
+}
+
+void printResult(const char* label, const Result& result) {
+    std::printf("  %-22s %8.3f ms/frame %12.0f tests %9.0f pairs %8.0f relinks\n",
+                label, result.msPerFrame, result.testsPerFrame, result.pairsPerFrame, result.relinksPerFrame);
+}
+}
+
+int main() {
+    const Workload workloads[] = {
+        {"uniform small (r 5-15)", 4000, 0, 0.0f, 0.0f, 1.0f},
+        {"mixed (+24 r 40-120)", 4000, 24, 40.0f, 120.0f, 1.0f},
+        {"bosses (+4 r 200-300)", 4000, 4, 200.0f, 300.0f, 1.0f},
+        {"dense small (r 5-15)", 20000, 0, 0.0f, 0.0f, 1.0f},
+        {"dense, 10% moving", 20000, 0, 0.0f, 0.0f, 0.1f},
+    };
+    
+    std::printf("%d frames, world %.0fx%.0f\n", kFrames, kWorldWidth, kWorldHeight);
+    for (const Workload& workload : workloads) {
+        std::printf("%s\n", workload.name);
+        Result uniform = runUniform(workload, 32.0f);
+        Result hierarchical = runHierarchical(workload, 16.0f);
+        Result cached = runPairCache(workload, 16.0f, 2.0f);
+        printResult("SpatialGrid (32)", uniform);
+        printResult("HierarchicalGrid (16)", hierarchical);
+        printResult("PairCache (margin 2)", cached);
+        
+        // All must report the same pairs
+        if (uniform.pairsPerFrame != hierarchical.pairsPerFrame || uniform.pairsPerFrame != cached.pairsPerFrame) {
+            std::printf("  MISMATCH: pair counts differ\n");
+            return 1;
+        }
+    }
+    return 0;
+}
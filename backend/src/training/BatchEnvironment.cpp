@@ -0,0 +1,211 @@
+// backend/src/training/BatchEnvironment.cpp
+#include "BatchEnvironment.h"
+#include "../entities/Archetypes.h"
+#include "../profiling/Profiler.h"
+#include <algorithm>
+#include <new>
+
+namespace {
+const float kTickLength = 1.0f / 60.0f;
+
+// Rewards: per tick survived, per point of health lost, and for dying
+const float kSurvivalReward = 0.01f;
+const float kDamagePenalty = 0.01f;
+const float kDeathPenalty = 1.0f;
+
+// Games per pool task; large enough to amortise the hand-out
+const int kEnvsPerTask = 16;
+
+// Every defined input bit
+const uint8_t kActionMask = static_cast<uint8_t>(Player::inputBit(PlayerInput::FIRE) * 2 - 1);
+
+// The K nearest of a stream of candidates, closest first
+struct NearestSet {
+    int capacity;
+    int count = 0;
+    float distanceSq[BatchEnvironment::kMaxNearest];
+    Vector2 offset[BatchEnvironment::kMaxNearest];
+    Vector2 velocity[BatchEnvironment::kMaxNearest];
+    
+    explicit NearestSet(int k) : capacity(k) {}
+    
+    void offer(const Vector2& relative, const Vector2& relativeVelocity) {
+        float d = relative.lengthSquared();
+        if (count == capacity && (capacity == 0 || d >= distanceSq[count - 1])) {
+            return;
+        }
+        
+        // Insertion into the sorted prefix; K is small
+        int i = count < capacity ? count++ : count - 1;
+        for (; i > 0 && distanceSq[i - 1] > d; --i) {
+            distanceSq[i] = distanceSq[i - 1];
+            offset[i] = offset[i - 1];
+            velocity[i] = velocity[i - 1];
+        }
+        distanceSq[i] = d;
+        offset[i] = relative;
+        velocity[i] = relativeVelocity;
+    }
+    
+    float* write(float* out, float width, float height, float speed) const {
+        for (int i = 0; i < capacity; ++i) {
+            bool present = i < count;
+            *out++ = present ? 1.0f : 0.0f;
+            *out++ = present ? offset[i].x / width : 0.0f;
+            *out++ = present ? offset[i].y / height : 0.0f;
+            *out++ = present ? velocity[i].x / speed : 0.0f;
+            *out++ = present ? velocity[i].y / speed : 0.0f;
+        }
+        return out;
+    }
+};
+}
+
+BatchEnvironment::BatchEnvironment(const BatchEnvironmentConfig& config)
+    : m_config(config),
+      m_envCount(std::max(config.envCount, 0)),
+      m_games(nullptr),
+      m_episodeSteps(m_envCount, 0),
+      m_lastHealth(m_envCount, 0.0f),
+      m_episodesFinished(m_envCount, 0),
+      m_pool(config.workerCount < 0 ? ThreadPool::defaultWorkerCount() : config.workerCount) {
+    m_config.nearestDrones = std::min(std::max(config.nearestDrones, 0), kMaxNearest);
+    m_config.nearestProjectiles = std::min(std::max(config.nearestProjectiles, 0), kMaxNearest);
+    m_config.frameSkip = std::max(config.frameSkip, 1);
+    m_observationSize = kPlayerFeatures + (m_config.nearestDrones + m_config.nearestProjectiles) * kObjectFeatures;
+    
+    m_games = m_allocator.allocate(m_envCount);
+    int constructed = 0;
+    try {
+        for (int i = 0; i < m_envCount; ++i) {
+            Game* game = new (m_games + i) Game(config.projectileCapacity);
+            constructed++;
+            game->setWorldSize(config.worldWidth, config.worldHeight);
+            game->setDeterministic(true);
+            game->setSeed(config.seed + static_cast<uint64_t>(i));
+        }
+    } catch (...) {
+        // The destructor will not run; undo the games built so far
+        while (constructed > 0) {
+            m_games[--constructed].~Game();
+        }
+        m_allocator.deallocate(m_games, m_envCount);
+        throw;
+    }
+}
+
+BatchEnvironment::~BatchEnvironment() {
+    for (int i = 0; i < m_envCount; ++i) {
+        m_games[i].~Game();
+    }
+    m_allocator.deallocate(m_games, m_envCount);
+}
+
+template<typename Fn>
+void BatchEnvironment::forEachChunk(Fn&& fn) {
+    int tasks = (m_envCount + kEnvsPerTask - 1) / kEnvsPerTask;
+    m_pool.parallelFor(tasks, [&](int task) {
+        // The profiler is single-threaded; games stepped here go untimed
+        bool profiled = Profiler::isThreadEnabled();
+        Profiler::setThreadEnabled(false);
+        int end = std::min((task + 1) * kEnvsPerTask, m_envCount);
+        for (int env = task * kEnvsPerTask; env < end; ++env) {
+            fn(env);
+        }
+        Profiler::setThreadEnabled(profiled);
+    });
+}
+
+void BatchEnvironment::reset(float* observations) {
+    forEachChunk([&](int env) {
+        resetEnv(env);
+        observe(env, observations + static_cast<size_t>(env) * m_observationSize);
+    });
+}
+
+void BatchEnvironment::step(const uint8_t* actions, float* observations, float* rewards, uint8_t* dones) {
+    forEachChunk([&](int env) {
+        stepEnv(env, actions[env], rewards[env], dones[env]);
+        observe(env, observations + static_cast<size_t>(env) * m_observationSize);
+    });
+}
+
+uint64_t BatchEnvironment::getEpisodesFinished() const {
+    uint64_t total = 0;
+    for (uint64_t count : m_episodesFinished) {
+        total += count;
+    }
+    return total;
+}
+
+void BatchEnvironment::resetEnv(int env) {
+    // Each initialize() moves the game on to its next seed
+    Game& game = m_games[env];
+    game.initialize();
+    m_episodeSteps[env] = 0;
+    m_lastHealth[env] = game.getPlayer()->getHealth();
+}
+
+void BatchEnvironment::stepEnv(int env, uint8_t action, float& reward, uint8_t& done) {
+    Game& game = m_games[env];
+    if (game.getState() != GameState::PLAYING) {
+        resetEnv(env);
+    }
+    
+    game.getPlayer()->setInputMask(action & kActionMask);
+    reward = 0.0f;
+    for (int tick = 0; tick < m_config.frameSkip && game.getState() == GameState::PLAYING; ++tick) {
+        game.update(kTickLength);
+        reward += kSurvivalReward;
+    }
+    
+    float health = game.getPlayer()->getHealth();
+    reward -= (m_lastHealth[env] - health) * kDamagePenalty;
+    m_lastHealth[env] = health;
+    m_episodeSteps[env]++;
+    
+    bool died = game.getState() != GameState::PLAYING;
+    bool cutOff = m_config.maxEpisodeSteps > 0 && m_episodeSteps[env] >= m_config.maxEpisodeSteps;
+    if (died) {
+        reward -= kDeathPenalty;
+    }
+    
+    done = died || cutOff ? 1 : 0;
+    if (done) {
+        m_episodesFinished[env]++;
+        resetEnv(env);
+    }
+}
+
+void BatchEnvironment::observe(int env, float* observation) const {
+    const Game& game = m_games[env];
+    const Player& player = *game.getPlayer();
+    float width = m_config.worldWidth;
+    float height = m_config.worldHeight;
+    float speed = getArchetype(ProjectileType::PLAYER).speed;
+    
+    Vector2 position = player.getPosition();
+    Vector2 velocity = player.getVelocity();
+    *observation++ = position.x / width;
+    *observation++ = position.y / height;
+    *observation++ = velocity.x / speed;
+    *observation++ = velocity.y / speed;
+    *observation++ = player.getHealth() / 100.0f;
+    
+    NearestSet drones(m_config.nearestDrones);
+    for (const auto& entity : game.getEntities()) {
+        if (entity->getType() == EntityType::DRONE && entity->isActive()) {
+            drones.offer(entity->getPosition() - position, entity->getVelocity() - velocity);
+        }
+    }
+    observation = drones.write(observation, width, height, speed);
+    
+    NearestSet projectiles(m_config.nearestProjectiles);
+    const ProjectileSystem& pool = game.getProjectiles();
+    for (size_t i = 0; i < pool.getCount(); ++i) {
+        if (pool.getType(i) == ProjectileType::ENEMY) {
+            projectiles.offer(pool.getPosition(i) - position, pool.getVelocity(i) - velocity);
+        }
+    }
+    projectiles.write(observation, width, height, speed);
+}
@@ -0,0 +1,83 @@
+// backend/src/training/BatchEnvironment.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "../Game.h"
+#include "../concurrency/ThreadPool.h"
+
+struct BatchEnvironmentConfig {
+    int envCount = 64;
+    uint64_t seed = 1;                  // Env i starts from seed + i
+    int nearestDrones = 8;              // Drones in each observation
+    int nearestProjectiles = 8;         // Enemy projectiles in each observation
+    int frameSkip = 4;                  // Game ticks per step, repeating the action
+    int maxEpisodeSteps = 0;            // Steps before an episode is cut off; 0 never
+    float worldWidth = 800.0f;
+    float worldHeight = 600.0f;
+    size_t projectileCapacity = 1024;   // Per game
+    int workerCount = -1;               // -1 uses ThreadPool::defaultWorkerCount()
+};
+
+// N independent, seeded games stepped together for reinforcement learning.
+// The games sit in one contiguous block and are stepped in chunks across a
+// thread pool; every result goes into flat arrays the caller owns, so a
+// step allocates nothing. Games run deterministically, so a given seed and
+// action sequence always produce the same observations.
+//
+// Observation layout, all relative to the world size or the fastest
+// projectile speed:
+//   player: x, y, vx, vy, health / 100
+//   then nearestDrones and nearestProjectiles slots, closest first:
+//   present (0 or 1), dx, dy, dvx, dvy relative to the player
+class BatchEnvironment {
+public:
+    static constexpr int kPlayerFeatures = 5;
+    static constexpr int kObjectFeatures = 5;
+    static constexpr int kMaxNearest = 32;
+    
+    explicit BatchEnvironment(const BatchEnvironmentConfig& config);
+    ~BatchEnvironment();
+    
+    BatchEnvironment(const BatchEnvironment&) = delete;
+    BatchEnvironment& operator=(const BatchEnvironment&) = delete;
+    
+    int getEnvCount() const { return m_envCount; }
+    int getObservationSize() const { return m_observationSize; }
+    
+    // Start every episode over; observations holds envCount * observationSize
+    void reset(float* observations);
+    
+    // actions[i] is env i's held-input mask (Player::inputBit bits).
+    // A finished episode reports done and the reward of its last step,
+    // then starts over at once: its observation is the new episode's first.
+    void step(const uint8_t* actions, float* observations, float* rewards, uint8_t* dones);
+    
+    Game& getGame(int env) { return m_games[env]; }
+    uint64_t getEpisodesFinished() const;
+
+private:
+    BatchEnvironmentConfig m_config;
+    int m_envCount;
+    int m_observationSize;
+    
+    // Games are constructed in place and never move
+    std::allocator<Game> m_allocator;
+    Game* m_games;
+    
+    // Per-env episode bookkeeping
+    std::vector<int> m_episodeSteps;
+    std::vector<float> m_lastHealth;
+    std::vector<uint64_t> m_episodesFinished;
+    
+    ThreadPool m_pool;
+    
+    void resetEnv(int env);
+    void stepEnv(int env, uint8_t action, float& reward, uint8_t& done);
+    void observe(int env, float* observation) const;
+    
+    template<typename Fn>
+    void forEachChunk(Fn&& fn);
+};
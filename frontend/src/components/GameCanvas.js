@@ -30,6 +30,25 @@ const GameCanvas = ({ width, height, audioManager }) => {
     initWasm();
   }, []);
   
+  // Group plain entity objects the way the C++ draw list does; used by
+  // the JavaScript fallback when the WebAssembly module is not loaded
+  const groupEntities = (entities) => {
+    const counts = [0, 0, 0, 0];
+    entities.forEach(entity => counts[entity.type]++);
+    
+    const offsets = [0, counts[0], counts[0] + counts[1], counts[0] + counts[1] + counts[2]];
+    const next = offsets.slice();
+    const items = new Float32Array(entities.length * 4);
+    entities.forEach(entity => {
+      const base = next[entity.type]++ * 4;
+      items[base] = entity.id;
+      items[base + 1] = entity.x;
+      items[base + 2] = entity.y;
+      items[base + 3] = entity.radius;
+    });
+    return { offsets, counts, items };
+  };
+  
   // Render function for the game
   const renderGame = (ctx, entities, gameState) => {
     // Clear canvas
@@ -45,64 +64,73 @@ const GameCanvas = ({ width, height, audioManager }) => {
       return;
     }
     
-    // Render all entities
-    entities.forEach(entity => {
-      switch (entity.type) {
-        case ENTITY_TYPE.PLAYER:
-          renderPlayer(ctx, entity);
-          break;
-        case ENTITY_TYPE.DRONE:
-          renderDrone(ctx, entity);
-          break;
-        case ENTITY_TYPE.PROJECTILE:
-          renderProjectile(ctx, entity);
-          break;
-        case ENTITY_TYPE.POWERUP:
-          renderPowerup(ctx, entity);
-          break;
-        default:
-          break;
-      }
-    });
+    // Entities arrive grouped by type and culled to the canvas, so each
+    // group is drawn with one style setup and one fill
+    const drawList = wasmModule.getDrawList({ minX: 0, minY: 0, maxX: width, maxY: height }) ||
+                     groupEntities(entities);
+    const { offsets, counts, items } = drawList;
+    
+    renderPlayers(ctx, items, offsets[ENTITY_TYPE.PLAYER], counts[ENTITY_TYPE.PLAYER]);
+    renderDrones(ctx, items, offsets[ENTITY_TYPE.DRONE], counts[ENTITY_TYPE.DRONE]);
+    renderPowerups(ctx, items, offsets[ENTITY_TYPE.POWERUP], counts[ENTITY_TYPE.POWERUP]);
+    renderProjectiles(ctx, items, offsets[ENTITY_TYPE.PROJECTILE], counts[ENTITY_TYPE.PROJECTILE]);
     
     // Render UI
     renderUI(ctx);
   };
   
+  // Group renderers take a range of items, each (id, x, y, radius)
+  
   // Render player
-  const renderPlayer = (ctx, entity) => {
+  const renderPlayers = (ctx, items, offset, count) => {
     ctx.fillStyle = '#4287f5';
     ctx.beginPath();
-    ctx.arc(entity.x, entity.y, entity.radius, 0, Math.PI * 2);
+    for (let i = offset; i < offset + count; i++) {
+      const x = items[i * 4 + 1];
+      const y = items[i * 4 + 2];
+      const radius = items[i * 4 + 3];
+      ctx.moveTo(x + radius, y);
+      ctx.arc(x, y, radius, 0, Math.PI * 2);
+    }
     ctx.fill();
     
     // Add details to player
     ctx.strokeStyle = '#ffffff';
     ctx.lineWidth = 2;
     ctx.beginPath();
-    ctx.arc(entity.x, entity.y, entity.radius * 0.7, 0, Math.PI * 2);
+    for (let i = offset; i < offset + count; i++) {
+      const x = items[i * 4 + 1];
+      const y = items[i * 4 + 2];
+      const radius = items[i * 4 + 3] * 0.7;
+      ctx.moveTo(x + radius, y);
+      ctx.arc(x, y, radius, 0, Math.PI * 2);
+    }
     ctx.stroke();
   };
   
-  // Render drone
-  const renderDrone = (ctx, entity) => {
-    ctx.fillStyle = '#e74c3c';
-    
-    // Draw hexagon shape for drones
-    ctx.beginPath();
+  // Render drones as hexagons, all in one path
+  const renderDrones = (ctx, items, offset, count) => {
     const sides = 6;
-    for (let i = 0; i < sides; i++) {
-      const angle = (i * 2 * Math.PI / sides) + Math.PI / 6;
-      const x = entity.x + entity.radius * Math.cos(angle);
-      const y = entity.y + entity.radius * Math.sin(angle);
-      
-      if (i === 0) {
-        ctx.moveTo(x, y);
-      } else {
-        ctx.lineTo(x, y);
+    ctx.beginPath();
+    for (let d = offset; d < offset + count; d++) {
+      const cx = items[d * 4 + 1];
+      const cy = items[d * 4 + 2];
+      const radius = items[d * 4 + 3];
+      for (let i = 0; i < sides; i++) {
+        const angle = (i * 2 * Math.PI / sides) + Math.PI / 6;
+        const x = cx + radius * Math.cos(angle);
+        const y = cy + radius * Math.sin(angle);
+        
+        if (i === 0) {
+          ctx.moveTo(x, y);
+        } else {
+          ctx.lineTo(x, y);
+        }
       }
+      ctx.closePath();
     }
-    ctx.closePath();
+    
+    ctx.fillStyle = '#e74c3c';
     ctx.fill();
     
     // Add details
@@ -111,19 +139,30 @@ const GameCanvas = ({ width, height, audioManager }) => {
     ctx.stroke();
   };
   
-  // Render projectile
-  const renderProjectile = (ctx, entity) => {
+  // Render projectiles
+  const renderProjectiles = (ctx, items, offset, count) => {
     ctx.fillStyle = '#f1c40f';
     ctx.beginPath();
-    ctx.arc(entity.x, entity.y, entity.radius, 0, Math.PI * 2);
+    for (let i = offset; i < offset + count; i++) {
+      const x = items[i * 4 + 1];
+      const y = items[i * 4 + 2];
+      const radius = items[i * 4 + 3];
+      ctx.moveTo(x + radius, y);
+      ctx.arc(x, y, radius, 0, Math.PI * 2);
+    }
     ctx.fill();
   };
   
-  // Render powerup
-  const renderPowerup = (ctx, entity) => {
+  // Render powerups
+  const renderPowerups = (ctx, items, offset, count) => {
     ctx.fillStyle = '#2ecc71';
     ctx.beginPath();
-    ctx.rect(entity.x - entity.radius, entity.y - entity.radius, entity.radius * 2, entity.radius * 2);
+    for (let i = offset; i < offset + count; i++) {
+      const x = items[i * 4 + 1];
+      const y = items[i * 4 + 2];
+      const radius = items[i * 4 + 3];
+      ctx.rect(x - radius, y - radius, radius * 2, radius * 2);
+    }
     ctx.fill();
   };
   
@@ -14,9 +14,12 @@ const wasmModule = {
       const wasmBytes = await response.arrayBuffer();
       
       // Load the JavaScript glue code
-      // We're using the global DodgeballModule that was created in public/wasm/dodgeball.js
+      // We're using the global DodgeballModule that was created in public/wasm/dodgeball.js.
+      // The Emscripten build is modularized: DodgeballModule is a factory
+      // that resolves to the module once the runtime is ready.
       if (typeof DodgeballModule !== 'undefined') {
-        this.instance = DodgeballModule;
+        this.instance = typeof DodgeballModule === 'function' ? await DodgeballModule() : DodgeballModule;
+        this.instance._initGame();
         this.initialized = true;
         console.log('WebAssembly module loaded successfully');
         return true;
@@ -37,6 +40,12 @@ const wasmModule = {
     }
   },
   
+  // Current view of WebAssembly memory. Memory growth replaces the
+  // buffer, so views are created from this on every call.
+  getBuffer() {
+    return this.instance.HEAPU8 ? this.instance.HEAPU8.buffer : null;
+  },
+  
   // Setup fallback implementation for development
   setupFallbackImplementation() {
     console.log('Using JavaScript fallback implementation');
@@ -207,18 +216,85 @@ const wasmModule = {
       return;
     }
     
-    // In a real implementation, this would get data from WebAssembly
+    // The placeholder glue in public/wasm has no heap; it hands out its
+    // entities directly
+    if (!this.getBuffer()) {
+      this.entityData = this.instance.getEntities ? [...this.instance.getEntities()] : [];
+      return;
+    }
+    
     const entityCount = this.instance._getEntityCount();
     
-    // We'll use our mock implementation for now
-    if (!this.entityData || this.entityData.length === 0) {
-      this.entityData = [
-        { id: 1, type: 0, x: 400, y: 300, radius: 15 }, // Player
-        { id: 2, type: 1, x: 200, y: 100, radius: 12 }, // Drone
-        { id: 3, type: 1, x: 600, y: 100, radius: 12 }, // Drone
-        { id: 4, type: 1, x: 300, y: 500, radius: 12 }  // Drone
-      ];
+    // Skip if no entities
+    if (entityCount <= 0) {
+      this.entityData = [];
+      return;
+    }
+    
+    // Allocate memory in WebAssembly module for entity data
+    const dataSize = entityCount * 5 * 4; // 5 fields per entity, 4 bytes per field
+    const dataPtr = this.instance._malloc(dataSize);
+    
+    if (!dataPtr) {
+      console.error('Failed to allocate memory for entity data');
+      return;
+    }
+    
+    // Get entity data from WebAssembly
+    this.instance._getEntityData(dataPtr, entityCount);
+    
+    try {
+      // Copy data from WebAssembly memory
+      const dataView = new DataView(this.getBuffer(), dataPtr, dataSize);
+      
+      // Parse entity data
+      this.entityData = [];
+      for (let i = 0; i < entityCount; i++) {
+        const offset = i * 5 * 4;
+        
+        this.entityData.push({
+          id: dataView.getInt32(offset, true),
+          type: dataView.getInt32(offset + 4, true),
+          x: dataView.getFloat32(offset + 8, true),
+          y: dataView.getFloat32(offset + 12, true),
+          radius: dataView.getFloat32(offset + 16, true)
+        });
+      }
+    } catch (error) {
+      console.error('Error parsing entity data:', error);
+    } finally {
+      // Free allocated memory
+      this.instance._free(dataPtr);
+    }
+  },
+  
+  // Build the draw list on the C++ side and read it in place. Items are
+  // grouped by entity type: group t is items [offsets[t], offsets[t] +
+  // counts[t]), each item 4 fields (id, x, y, radius). Pass a viewport
+  // { minX, minY, maxX, maxY } to skip off-screen items. The views are
+  // valid until the next call.
+  getDrawList(viewport) {
+    if (!this.initialized || !this.instance._buildDrawList || !this.getBuffer()) {
+      return null;
     }
+    
+    const view = viewport || { minX: 0, minY: 0, maxX: 0, maxY: 0 };
+    const count = this.instance._buildDrawList(view.minX, view.minY, view.maxX, view.maxY);
+    const headerPtr = this.instance._getDrawListHeader();
+    const itemsPtr = this.instance._getDrawListItems();
+    const buffer = this.getBuffer();
+    
+    // Field order mirrors DrawListHeader in backend/src/render/DrawList.h
+    const header = new Uint32Array(buffer, headerPtr, 11);
+    return {
+      version: header[0],
+      count: header[1],
+      culled: header[2],
+      offsets: Array.from(header.subarray(3, 7)),
+      counts: Array.from(header.subarray(7, 11)),
+      ids: new Int32Array(buffer, itemsPtr, count * 4),
+      items: new Float32Array(buffer, itemsPtr, count * 4)
+    };
   },
   
   // Get player health
@@ -230,6 +306,199 @@ const wasmModule = {
     return this.instance._getPlayerHealth();
   },
   
+  // Render a block of interleaved stereo samples from the C++ mixer.
+  // Intended to be called from the AudioWorklet's message handler.
+  mixAudio(frames) {
+    if (!this.initialized || !this.instance._mixAudio || !this.getBuffer()) {
+      return null;
+    }
+    
+    const byteLength = frames * 2 * 4;
+    if (!this.audioPtr || this.audioBytes < byteLength) {
+      if (this.audioPtr) {
+        this.instance._free(this.audioPtr);
+      }
+      this.audioPtr = this.instance._malloc(byteLength);
+      this.audioBytes = byteLength;
+    }
+    
+    this.instance._mixAudio(this.audioPtr, frames);
+    return new Float32Array(this.getBuffer(), this.audioPtr, frames * 2).slice();
+  },
+  
+  // Read the runtime statistics block. Field order mirrors GameStats in
+  // backend/src/engine/GameStats.h; every field is 4 bytes.
+  getStats() {
+    if (!this.initialized || !this.instance._getStats || !this.getBuffer()) {
+      return null;
+    }
+    
+    if (!this.statsPtr) {
+      this.statsSize = this.instance._getStats(0, 0);
+      this.statsPtr = this.instance._malloc(this.statsSize);
+      if (!this.statsPtr) {
+        console.error('Failed to allocate memory for stats');
+        return null;
+      }
+    }
+    
+    this.instance._getStats(this.statsPtr, this.statsSize);
+    const u32 = new Uint32Array(this.getBuffer(), this.statsPtr, this.statsSize / 4);
+    const f32 = new Float32Array(this.getBuffer(), this.statsPtr, this.statsSize / 4);
+    
+    return {
+      version: u32[0],
+      frame: u32[1],
+      simulationTime: f32[2],
+      frameTimeMs: f32[3],
+      entityCounts: Array.from(u32.subarray(4, 8)),
+      pairTests: u32[8],
+      collisions: u32[9],
+      projectileHits: u32[10],
+      allocations: u32[11],
+      allocatedBytes: u32[12],
+      aiThinks: u32[13],
+      aiDeferred: u32[14],
+      aiBudgetOverruns: u32[15],
+      aiCostMs: f32[16],
+      aiCostUsPerThink: Array.from(f32.subarray(17, 20)),
+      physicsMs: f32[20],
+      gameLogicMs: f32[21],
+      audioMs: f32[22],
+      avgFrameTimeMs: f32[23],
+      avgPairTests: f32[24],
+      avgCollisions: f32[25],
+      avgAllocations: f32[26],
+      arenaUsedBytes: u32[27],
+      arenaHighWaterBytes: u32[28],
+      filteredPairs: u32[29],
+      cachedPairs: u32[30],
+      contactBegins: u32[31],
+      contactEnds: u32[32],
+      broadphaseMoved: u32[33],
+      timersPending: u32[34],
+      timersFired: u32[35],
+      physicsContacts: u32[36],
+      physicsIterations: u32[37],
+      physicsResidual: f32[38],
+      wave: u32[39],
+      pendingSpawns: u32[40],
+      degradationLevel: u32[41],
+      governedTickMs: f32[42]
+    };
+  },
+  
+  // Read the gameplay events emitted since the last call. Field order
+  // mirrors GameEvent in backend/src/engine/GameEvents.h; every field is
+  // 4 bytes. Types: 0 player damaged, 1 player died, 2 drone spawned,
+  // 3 drone destroyed, 4 power-up collected, 5 projectile fired.
+  drainEvents() {
+    if (!this.initialized || !this.instance._drainGameEvents || !this.getBuffer()) {
+      return [];
+    }
+    
+    const eventSize = 7 * 4;
+    const batchSize = 256;
+    if (!this.eventsPtr) {
+      this.eventsPtr = this.instance._malloc(eventSize * batchSize);
+      if (!this.eventsPtr) {
+        console.error('Failed to allocate memory for events');
+        return [];
+      }
+    }
+    
+    // One export call per batch of events, not one per event
+    const events = [];
+    let count;
+    do {
+      count = this.instance._drainGameEvents(this.eventsPtr, batchSize);
+      const buffer = this.getBuffer();
+      const u32 = new Uint32Array(buffer, this.eventsPtr, count * 7);
+      const i32 = new Int32Array(buffer, this.eventsPtr, count * 7);
+      const f32 = new Float32Array(buffer, this.eventsPtr, count * 7);
+      for (let i = 0; i < count; i++) {
+        const base = i * 7;
+        events.push({
+          type: u32[base],
+          frame: u32[base + 1],
+          entityId: i32[base + 2],
+          otherId: i32[base + 3],
+          x: f32[base + 4],
+          y: f32[base + 5],
+          value: f32[base + 6]
+        });
+      }
+    } while (count === batchSize);
+    
+    return events;
+  },
+  
+  // Have the C++ mixer play a loaded sound for every event of a type
+  setEventSound(eventType, soundId, volume = 1.0) {
+    if (this.initialized && this.instance._setEventSound) {
+      this.instance._setEventSound(eventType, soundId, volume);
+    }
+  },
+  
+  // Start recording the current match as a replay
+  startReplayRecording() {
+    if (!this.initialized || !this.instance._startReplayRecording) {
+      return false;
+    }
+    return !!this.instance._startReplayRecording();
+  },
+  
+  // Stop recording and return the replay file as a Uint8Array
+  stopReplayRecording() {
+    if (!this.initialized || !this.instance._stopReplayRecording || !this.getBuffer()) {
+      return null;
+    }
+    
+    if (!this.instance._stopReplayRecording()) {
+      return null;
+    }
+    
+    // First call reports the size, second call fills the buffer
+    const length = this.instance._getReplayData(0, 0);
+    const dataPtr = this.instance._malloc(length);
+    
+    if (!dataPtr) {
+      console.error('Failed to allocate memory for replay');
+      return null;
+    }
+    
+    try {
+      this.instance._getReplayData(dataPtr, length);
+      return new Uint8Array(this.getBuffer(), dataPtr, length).slice();
+    } finally {
+      this.instance._free(dataPtr);
+    }
+  },
+  
+  // Get the profiler's Chrome trace JSON (load it in chrome://tracing)
+  getProfilerTrace() {
+    if (!this.initialized || !this.instance._getProfilerTrace || !this.getBuffer()) {
+      return null;
+    }
+    
+    // First call reports the required size, second call fills the buffer
+    const length = this.instance._getProfilerTrace(0, 0);
+    const dataPtr = this.instance._malloc(length + 1);
+    
+    if (!dataPtr) {
+      console.error('Failed to allocate memory for profiler trace');
+      return null;
+    }
+    
+    try {
+      this.instance._getProfilerTrace(dataPtr, length + 1);
+      const bytes = new Uint8Array(this.getBuffer(), dataPtr, length);
+      return new TextDecoder().decode(bytes);
+    } finally {
+      this.instance._free(dataPtr);
+    }
+  },
+  
   // Get all entity data
   getEntities() {
     return this.entityData;